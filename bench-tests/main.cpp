@@ -1,21 +1,108 @@
 #include "nanobench.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cctype>
+#include <cstdlib>
 #include <filesystem>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <memory_resource>
+#include <new>
+#include <unordered_map>
+#include <vector>
 
 import Opal;
 
 using namespace Opal;
 
+// Track the global allocations to allow reporting allocations per operation
+static std::atomic<uint64_t> AllocationCount = 0;
+static std::atomic<uint64_t> AllocationBytes = 0;
+
+void* operator new(std::size_t size)
+{
+	AllocationCount++;
+	AllocationBytes += size;
+	auto result = std::malloc(size);
+	if (result == nullptr)
+		throw std::bad_alloc();
+	return result;
+}
+
+void operator delete(void* value) noexcept
+{
+	std::free(value);
+}
+
+void operator delete(void* value, std::size_t) noexcept
+{
+	std::free(value);
+}
+
+template<typename TOperation>
+void ReportAllocations(const char* name, TOperation&& operation)
+{
+	constexpr uint64_t iterations = 10000;
+	auto startCount = AllocationCount.load();
+	for (auto i = 0u; i < iterations; i++)
+		operation();
+
+	auto count = AllocationCount.load() - startCount;
+	std::cout << "| " << (double)count / iterations << " allocs/op | `" << name << "`" << std::endl;
+}
+
+template<typename TOperation>
+void ReportMemory(const char* name, TOperation&& operation)
+{
+	auto startCount = AllocationCount.load();
+	auto startBytes = AllocationBytes.load();
+	operation();
+
+	auto count = AllocationCount.load() - startCount;
+	auto bytes = AllocationBytes.load() - startBytes;
+	std::cout << "| " << count << " allocs, " << (double)bytes / (1024 * 1024) << " MB allocated | `" << name << "`" << std::endl;
+}
+
+/// <summary>
+/// Build a synthetic tree of 1M file paths spread over 10K directories
+/// </summary>
+std::vector<Path> BuildSyntheticTree()
+{
+	auto result = std::vector<Path>();
+	result.reserve(1000000);
+	auto root = Path("C:/Users/Me/source/repos/MyProject/out/obj/");
+	for (auto i = 0; i < 100; i++)
+	{
+		auto moduleDirectory = root + Path("./Module" + std::to_string(i) + "/");
+		for (auto j = 0; j < 100; j++)
+		{
+			auto directory = moduleDirectory + Path("./Folder" + std::to_string(j) + "/");
+			for (auto k = 0; k < 100; k++)
+			{
+				result.push_back(directory + Path("./File" + std::to_string(k) + ".obj"));
+			}
+		}
+	}
+
+	return result;
+}
+
 int main()
 {
 	{
 		auto c = Path("C:/Path1/Path2/");
 		auto d = Path("./Path3/Path4/");
 
-		ankerl::nanobench::Bench().minEpochIterations(10000).run("Concatenate Paths", [&]
+		auto operation = [&]
 		{
 			auto e = c + d;
 			ankerl::nanobench::doNotOptimizeAway(e);
-		});
+		};
+
+		ankerl::nanobench::Bench().minEpochIterations(10000).run("Concatenate Paths", operation);
+		ReportAllocations("Concatenate Paths", operation);
 	}
 
 	{
@@ -30,11 +117,36 @@ int main()
 	}
 
 	{
-		ankerl::nanobench::Bench().minEpochIterations(100000).run("Initialize Path With Root", [&]
+		auto operation = [&]
 		{
 			auto e = Path("C:/Path1/Path2/");
 			ankerl::nanobench::doNotOptimizeAway(e);
-		});
+		};
+
+		ankerl::nanobench::Bench().minEpochIterations(100000).run("Initialize Path With Root", operation);
+		ReportAllocations("Initialize Path With Root", operation);
+	}
+
+	{
+		auto operation = [&]
+		{
+			auto e = Path("C:/Path1/Path2/"_path);
+			ankerl::nanobench::doNotOptimizeAway(e);
+		};
+
+		ankerl::nanobench::Bench().minEpochIterations(100000).run("Initialize Path With Root Literal", operation);
+		ReportAllocations("Initialize Path With Root Literal", operation);
+	}
+
+	{
+		auto operation = [&]
+		{
+			auto e = Path("C:/Users/Me/source/repos/MyProject/out/obj/Release/x64/MyLibrary/module.pcm");
+			ankerl::nanobench::doNotOptimizeAway(e);
+		};
+
+		ankerl::nanobench::Bench().minEpochIterations(100000).run("Initialize Long Path With Root", operation);
+		ReportAllocations("Initialize Long Path With Root", operation);
 	}
 
 	{
@@ -45,6 +157,107 @@ int main()
 		});
 	}
 
+	{
+		auto value = std::string_view(
+			"C:\\Users\\Me\\source\\repos\\MyProject\\out\\obj\\Release\\x64\\Generated\\"
+			"MyCompany.MyProduct.MyLibrary\\Intermediate\\Modules\\Partitions\\Interfaces\\"
+			"MyCompany.MyProduct.MyLibrary.Module.Partition.Interface.pcm");
+		auto uut = Path::CreateWindows(value);
+
+		ankerl::nanobench::Bench().minEpochIterations(100000).run("Create Windows Long Path With Root", [&]
+		{
+			auto e = Path::CreateWindows(value);
+			ankerl::nanobench::doNotOptimizeAway(e);
+		});
+
+		ankerl::nanobench::Bench().minEpochIterations(100000).run("Parse Windows Long Path With Root", [&]
+		{
+			auto e = Path::Parse(value);
+			ankerl::nanobench::doNotOptimizeAway(e);
+		});
+
+		ankerl::nanobench::Bench().minEpochIterations(100000).run("To Alternate String Long Path", [&]
+		{
+			auto e = uut.ToAlternateString();
+			ankerl::nanobench::doNotOptimizeAway(e);
+		});
+
+		auto copyOperation = [&]
+		{
+			auto e = uut;
+			ankerl::nanobench::doNotOptimizeAway(e);
+		};
+
+		ankerl::nanobench::Bench().minEpochIterations(100000).run("Copy Long Path", copyOperation);
+		ReportAllocations("Copy Long Path", copyOperation);
+
+		auto copyAndModifyOperation = [&]
+		{
+			auto e = uut;
+			e.SetFilename("Module.obj");
+			ankerl::nanobench::doNotOptimizeAway(e);
+		};
+
+		ankerl::nanobench::Bench().minEpochIterations(100000).run("Copy And Set Filename Long Path", copyAndModifyOperation);
+		ReportAllocations("Copy And Set Filename Long Path", copyAndModifyOperation);
+
+		// Copy a list of long paths the way the process and directory entry results are passed around
+		auto values = std::vector<Path>();
+		for (auto i = 0; i < 10000; i++)
+			values.push_back(uut.GetParent() + Path("./File" + std::to_string(i) + ".pcm"));
+
+		ankerl::nanobench::Bench().batch(values.size()).minEpochIterations(100).run("Copy 10K Long Paths", [&]
+		{
+			auto copies = values;
+			ankerl::nanobench::doNotOptimizeAway(copies);
+		});
+	}
+
+	{
+		// Simulate a build phase that creates many long short-lived paths that all die together
+		auto base = Path(
+			"C:/Users/Me/source/repos/MyProject/out/obj/Release/x64/Generated/"
+			"MyCompany.MyProduct.MyLibrary/Intermediate/Modules/Partitions/");
+		auto values = std::vector<std::string>();
+		for (auto i = 0; i < 1000; i++)
+			values.push_back(base.ToString() + "Interfaces" + std::to_string(i) + "/../Implementations/Module.Partition.pcm");
+
+		auto runPhase = [&](std::pmr::memory_resource* resource)
+		{
+			size_t size = 0;
+			for (auto& value : values)
+			{
+				auto file = resource != nullptr ? Path::Parse(value, resource) : Path::Parse(value);
+				auto directory = file.GetParent();
+				auto object = directory + Path("./Objects/Module.obj");
+				auto relative = object.GetRelativeTo(base);
+				size += relative.ToStringView().size();
+			}
+
+			return size;
+		};
+
+		auto heapPhase = [&]
+		{
+			ankerl::nanobench::doNotOptimizeAway(runPhase(nullptr));
+		};
+
+		auto buffer = std::vector<std::byte>(1024 * 1024);
+		auto arena = std::pmr::monotonic_buffer_resource(buffer.data(), buffer.size());
+		auto arenaPhase = [&]
+		{
+			ankerl::nanobench::doNotOptimizeAway(runPhase(&arena));
+
+			// Free the entire phase at once
+			arena.release();
+		};
+
+		ankerl::nanobench::Bench().batch(values.size()).minEpochIterations(100).run("Long Path Build Phase Heap", heapPhase);
+		ReportAllocations("Long Path Build Phase Heap", heapPhase);
+		ankerl::nanobench::Bench().batch(values.size()).minEpochIterations(100).run("Long Path Build Phase Arena", arenaPhase);
+		ReportAllocations("Long Path Build Phase Arena", arenaPhase);
+	}
+
 	{
 		ankerl::nanobench::Bench().minEpochIterations(100000).run("Initialize Path Relative", [&]
 		{
@@ -53,6 +266,654 @@ int main()
 		});
 	}
 
+	{
+		auto uut = Path("C:/Users/Me/source/repos/MyProject/out/obj/Release/");
+		auto operation = [&]
+		{
+			auto e = uut.GetParent();
+			ankerl::nanobench::doNotOptimizeAway(e);
+		};
+
+		ankerl::nanobench::Bench().minEpochIterations(100000).run("Get Parent Directory", operation);
+		ReportAllocations("Get Parent Directory", operation);
+	}
+
+	// Mutate the file name of a path that fits inline and one that spills to the heap
+	for (auto isLong : { false, true })
+	{
+		auto name = isLong ? "Long Path" : "Path";
+		auto directory = isLong ? std::string(100, 'a') + "/" : std::string();
+		auto uut = Path("C:/Users/Me/source/repos/MyProject/" + directory + "out/obj/Release/module.pcm");
+		auto bench = [&](const char* operationName, auto&& operation)
+		{
+			auto title = std::format("{} {}", operationName, name);
+			ankerl::nanobench::Bench().minEpochIterations(100000).run(title, operation);
+			ReportAllocations(title.c_str(), operation);
+		};
+
+		size_t iteration = 0;
+		auto setFilename = [&]
+		{
+			uut.SetFilename((iteration++ & 1) ? "module.pcm" : "other.obj");
+			ankerl::nanobench::doNotOptimizeAway(uut);
+		};
+
+		auto setFileExtension = [&]
+		{
+			uut.SetFileExtension((iteration++ & 1) ? "pcm" : "obj");
+			ankerl::nanobench::doNotOptimizeAway(uut);
+		};
+
+		auto getParent = [&]
+		{
+			auto e = uut.GetParent();
+			ankerl::nanobench::doNotOptimizeAway(e);
+		};
+
+		bench("Set Filename", setFilename);
+		bench("Set File Extension", setFileExtension);
+		bench("Get Parent", getParent);
+	}
+
+	{
+		auto uut = Path("C:/Users/Me/source/repos/MyProject/out/obj/Release/module.pcm");
+		auto base = Path("C:/Users/Me/source/repos/MyProject/out/bin/");
+		auto operation = [&]
+		{
+			auto e = uut.GetRelativeTo(base);
+			ankerl::nanobench::doNotOptimizeAway(e);
+		};
+
+		ankerl::nanobench::Bench().minEpochIterations(100000).run("Get Relative To", operation);
+		ReportAllocations("Get Relative To", operation);
+	}
+
+	{
+		auto files = BuildSyntheticTree();
+
+		auto internDirectories = [&]
+		{
+			auto pool = PathPool();
+			auto directories = std::vector<InternedPath>();
+			directories.reserve(files.size());
+			for (auto& file : files)
+				directories.push_back(pool.Intern(file.GetParent()));
+			ankerl::nanobench::doNotOptimizeAway(directories);
+		};
+
+		auto copyDirectories = [&]
+		{
+			auto directories = std::vector<Path>();
+			directories.reserve(files.size());
+			for (auto& file : files)
+				directories.push_back(file.GetParent());
+			ankerl::nanobench::doNotOptimizeAway(directories);
+		};
+
+		ankerl::nanobench::Bench().batch(files.size()).epochs(3).minEpochIterations(1).run("Intern 1M Path Directories", internDirectories);
+		ReportMemory("Intern 1M Path Directories", internDirectories);
+		ankerl::nanobench::Bench().batch(files.size()).epochs(3).minEpochIterations(1).run("Copy 1M Path Directories", copyDirectories);
+		ReportMemory("Copy 1M Path Directories", copyDirectories);
+
+		auto pool = PathPool();
+		auto handles = std::vector<InternedPath>();
+		for (auto& file : files)
+			handles.push_back(pool.Intern(file));
+
+		ankerl::nanobench::Bench().batch(files.size()).epochs(3).minEpochIterations(1).run("Compare 1M Interned Paths", [&]
+		{
+			size_t matches = 0;
+			for (auto i = 1u; i < handles.size(); i++)
+				matches += handles[i] == handles[i - 1];
+			ankerl::nanobench::doNotOptimizeAway(matches);
+		});
+
+		ankerl::nanobench::Bench().batch(files.size()).epochs(3).minEpochIterations(1).run("Compare 1M Paths", [&]
+		{
+			size_t matches = 0;
+			for (auto i = 1u; i < files.size(); i++)
+				matches += files[i] == files[i - 1];
+			ankerl::nanobench::doNotOptimizeAway(matches);
+		});
+
+		// Classify the file extensions of a newline delimited buffer
+		auto buffer = std::string();
+		for (auto& file : files)
+		{
+			buffer.append(file.ToStringView());
+			buffer.push_back('\n');
+		}
+
+		auto forEachLine = [&](auto&& callback)
+		{
+			auto value = std::string_view(buffer);
+			size_t current = 0;
+			size_t next = 0;
+			while ((next = value.find('\n', current)) != std::string_view::npos)
+			{
+				callback(value.substr(current, next - current));
+				current = next + 1;
+			}
+		};
+
+		auto classifyViews = [&]
+		{
+			size_t matches = 0;
+			forEachLine([&](std::string_view line)
+			{
+				matches += PathView(line).GetFileExtension() == ".obj";
+			});
+			ankerl::nanobench::doNotOptimizeAway(matches);
+		};
+
+		auto classifyPaths = [&]
+		{
+			size_t matches = 0;
+			forEachLine([&](std::string_view line)
+			{
+				matches += Path(line).GetFileExtension() == ".obj";
+			});
+			ankerl::nanobench::doNotOptimizeAway(matches);
+		};
+
+		ankerl::nanobench::Bench().batch(files.size()).epochs(3).minEpochIterations(1).run("Classify 1M Path Views", classifyViews);
+		ReportMemory("Classify 1M Path Views", classifyViews);
+		ankerl::nanobench::Bench().batch(files.size()).epochs(3).minEpochIterations(1).run("Classify 1M Paths", classifyPaths);
+		ReportMemory("Classify 1M Paths", classifyPaths);
+
+		// Compare loading untrusted values where every tenth entry is not a valid path
+		{
+			auto corpus = std::vector<std::string>();
+			corpus.reserve(100000);
+			for (auto i = 0u; i < 100000; i++)
+			{
+				if (i % 10 == 0)
+					corpus.push_back(i % 20 == 0 ? "Folder/File" + std::to_string(i) + ".cpp" : "File" + std::to_string(i) + ".cpp");
+				else
+					corpus.push_back(files[i].ToString());
+			}
+
+			ankerl::nanobench::Bench().batch(corpus.size()).epochs(3).minEpochIterations(1).run("Load 100K Paths 10% Invalid Throw", [&]
+			{
+				size_t valid = 0;
+				for (auto& value : corpus)
+				{
+					try
+					{
+						auto path = Path(value);
+						valid += path.HasFileName();
+					}
+					catch (const std::runtime_error&)
+					{
+					}
+				}
+				ankerl::nanobench::doNotOptimizeAway(valid);
+			});
+
+			ankerl::nanobench::Bench().batch(corpus.size()).epochs(3).minEpochIterations(1).run("Load 100K Paths 10% Invalid TryCreate", [&]
+			{
+				size_t valid = 0;
+				auto path = Path();
+				for (auto& value : corpus)
+				{
+					if (Path::TryCreate(value, path))
+						valid += path.HasFileName();
+				}
+				ankerl::nanobench::doNotOptimizeAway(valid);
+			});
+		}
+
+		// Compare loading a saved list at startup from the text lines against the binary path list
+		{
+			auto sorted = files;
+			std::sort(sorted.begin(), sorted.end());
+			auto textBuffer = std::string();
+			auto writer = PathListWriter();
+			for (auto& file : sorted)
+			{
+				textBuffer.append(file.ToStringView());
+				textBuffer.push_back('\n');
+				writer.Write(file);
+			}
+
+			auto listData = writer.GetData();
+			std::cout << "| " << (double)textBuffer.size() / (1024 * 1024) << " MB text, " <<
+				(double)listData.size() / (1024 * 1024) << " MB path list | `Save 1M Paths`" << std::endl;
+
+			auto forEachTextLine = [&](auto&& callback)
+			{
+				auto value = std::string_view(textBuffer);
+				size_t current = 0;
+				size_t next = 0;
+				while ((next = value.find('\n', current)) != std::string_view::npos)
+				{
+					callback(value.substr(current, next - current));
+					current = next + 1;
+				}
+			};
+
+			ankerl::nanobench::Bench().batch(sorted.size()).epochs(3).minEpochIterations(1).run("Startup 1M Paths Parse", [&]
+			{
+				auto paths = std::vector<Path>();
+				paths.reserve(sorted.size());
+				forEachTextLine([&](std::string_view line) { paths.push_back(Path::Parse(line)); });
+				ankerl::nanobench::doNotOptimizeAway(paths);
+			});
+
+			ankerl::nanobench::Bench().batch(sorted.size()).epochs(3).minEpochIterations(1).run("Startup 1M Paths Load Direct", [&]
+			{
+				auto paths = std::vector<Path>();
+				paths.reserve(sorted.size());
+				forEachTextLine([&](std::string_view line) { paths.push_back(Path(line)); });
+				ankerl::nanobench::doNotOptimizeAway(paths);
+			});
+
+			ankerl::nanobench::Bench().batch(sorted.size()).epochs(3).minEpochIterations(1).run("Startup 1M Paths Path List", [&]
+			{
+				auto paths = std::vector<Path>();
+				PathListReader(listData).ReadAll(paths);
+				ankerl::nanobench::doNotOptimizeAway(paths);
+			});
+
+			auto readViews = [&]
+			{
+				auto values = std::string();
+				auto views = std::vector<PathView>();
+				PathListReader(listData).ReadAll(values, views);
+				ankerl::nanobench::doNotOptimizeAway(views);
+			};
+
+			ankerl::nanobench::Bench().batch(sorted.size()).epochs(3).minEpochIterations(1).run("Startup 1M Path Views Path List", readViews);
+			ReportMemory("Startup 1M Path Views Path List", readViews);
+		}
+
+		// Compare splitting a compiler dependency file by hand against the bulk path list parser
+		{
+			// Build a synthetic 50 MB depfile with one rule per object file and one header per line
+			auto depfile = std::string();
+			for (size_t i = 0; depfile.size() < 50 * 1024 * 1024; i++)
+			{
+				depfile.append(files[i].ToStringView());
+				depfile.append(": \\\n");
+				for (size_t j = 0; j < 50; j++)
+				{
+					depfile.append("  ");
+					if (j % 10 == 0)
+						depfile.append("C:/Program\\ Files/SDK/Include/Header" + std::to_string(j) + ".h");
+					else
+						depfile.append(files[(i * 50 + j) % files.size()].ToStringView());
+					depfile.append(j + 1 < 50 ? " \\\n" : "\n");
+				}
+			}
+
+			auto parseByHand = [&]
+			{
+				auto paths = std::vector<Path>();
+				auto word = std::string();
+				bool isTarget = true;
+				auto addWord = [&]()
+				{
+					if (word.empty())
+						return;
+					else if (isTarget)
+						isTarget = word.back() != ':';
+					else
+						paths.push_back(Path::Parse(word));
+					word.clear();
+				};
+
+				for (size_t location = 0; location < depfile.size(); location++)
+				{
+					auto current = depfile[location];
+					auto next = location + 1 < depfile.size() ? depfile[location + 1] : '\0';
+					if (current == '\\' && next == ' ')
+					{
+						word.push_back(' ');
+						location++;
+					}
+					else if (current == '\\' && next == '\n')
+					{
+						addWord();
+						location++;
+					}
+					else if (current == ' ' || current == '\n')
+					{
+						addWord();
+						if (current == '\n')
+							isTarget = true;
+					}
+					else
+					{
+						word.push_back(current);
+					}
+				}
+
+				addWord();
+				ankerl::nanobench::doNotOptimizeAway(paths);
+			};
+
+			auto parseDependencies = [&]
+			{
+				auto paths = std::vector<Path>();
+				PathListParser::ParseDependencies(depfile, paths);
+				ankerl::nanobench::doNotOptimizeAway(paths);
+			};
+
+			auto parseDependenciesViews = [&]
+			{
+				auto buffer = std::string();
+				auto views = std::vector<PathView>();
+				PathListParser::ParseDependencies(depfile, buffer, views);
+				ankerl::nanobench::doNotOptimizeAway(views);
+			};
+
+			auto bench = [&](const char* name, auto&& operation)
+			{
+				ankerl::nanobench::Bench().batch(depfile.size()).unit("byte").epochs(3).minEpochIterations(1).run(name, operation);
+				ReportMemory(name, operation);
+			};
+
+			bench("Parse 50MB Depfile By Hand", parseByHand);
+			bench("Parse 50MB Depfile PathListParser", parseDependencies);
+			bench("Parse 50MB Depfile PathListParser Views", parseDependenciesViews);
+		}
+
+		// Compare repeated component queries that scan the value against the inline component index
+		{
+			auto indexed = files;
+			for (auto& file : indexed)
+				file.BuildComponentIndex();
+
+			for (auto isIndexed : { false, true })
+			{
+				auto name = isIndexed ? " Indexed" : "";
+				auto paths = isIndexed ? &indexed : &files;
+				auto bench = [&](const char* operationName, auto&& operation)
+				{
+					auto title = std::format("{} 1M Paths{}", operationName, name);
+					ankerl::nanobench::Bench().batch(paths->size()).epochs(3).minEpochIterations(1).run(title, operation);
+				};
+
+				bench("Get Depth", [&]
+				{
+					size_t depth = 0;
+					for (auto& path : *paths)
+						depth += path.GetDepth();
+					ankerl::nanobench::doNotOptimizeAway(depth);
+				});
+
+				bench("Get Component", [&]
+				{
+					size_t size = 0;
+					for (auto& path : *paths)
+						size += path.GetComponent(8).size();
+					ankerl::nanobench::doNotOptimizeAway(size);
+				});
+
+				bench("Common Prefix Length", [&]
+				{
+					size_t count = 0;
+					for (auto i = 1u; i < paths->size(); i++)
+						count += (*paths)[i].CommonPrefixLength((*paths)[i - 1]);
+					ankerl::nanobench::doNotOptimizeAway(count);
+				});
+			}
+		}
+
+		// Compare the path containers against the standard containers
+		for (size_t count : { 10000, 100000, 1000000 })
+		{
+			auto keys = std::vector<Path>(files.begin(), files.begin() + count);
+			auto bench = [&](const char* name, auto&& operation)
+			{
+				auto title = std::format("{} {}", name, count);
+				ankerl::nanobench::Bench().batch(count).epochs(3).minEpochIterations(1).run(title, operation);
+			};
+
+			bench("Insert PathMap", [&]
+			{
+				auto map = PathMap<size_t>();
+				for (auto i = 0u; i < keys.size(); i++)
+					map.Insert(keys[i], i);
+				ankerl::nanobench::doNotOptimizeAway(map);
+			});
+
+			bench("Insert std::map", [&]
+			{
+				auto map = std::map<Path, size_t>();
+				for (auto i = 0u; i < keys.size(); i++)
+					map.emplace(keys[i], i);
+				ankerl::nanobench::doNotOptimizeAway(map);
+			});
+
+			bench("Insert std::unordered_map", [&]
+			{
+				auto map = std::unordered_map<Path, size_t>();
+				for (auto i = 0u; i < keys.size(); i++)
+					map.emplace(keys[i], i);
+				ankerl::nanobench::doNotOptimizeAway(map);
+			});
+
+			auto pathMap = PathMap<size_t>();
+			auto orderedMap = std::map<Path, size_t>();
+			auto unorderedMap = std::unordered_map<Path, size_t>();
+			for (auto i = 0u; i < keys.size(); i++)
+			{
+				pathMap.Insert(keys[i], i);
+				orderedMap.emplace(keys[i], i);
+				unorderedMap.emplace(keys[i], i);
+			}
+
+			bench("Lookup PathMap", [&]
+			{
+				size_t sum = 0;
+				for (auto& key : keys)
+				{
+					const size_t* value;
+					if (pathMap.TryGet(key, value))
+						sum += *value;
+				}
+				ankerl::nanobench::doNotOptimizeAway(sum);
+			});
+
+			bench("Lookup std::map", [&]
+			{
+				size_t sum = 0;
+				for (auto& key : keys)
+					sum += orderedMap.find(key)->second;
+				ankerl::nanobench::doNotOptimizeAway(sum);
+			});
+
+			bench("Lookup std::unordered_map", [&]
+			{
+				size_t sum = 0;
+				for (auto& key : keys)
+					sum += unorderedMap.find(key)->second;
+				ankerl::nanobench::doNotOptimizeAway(sum);
+			});
+		}
+
+		// Compare looking up differently cased paths by folding while hashing against lowering a copy of every key
+		{
+			constexpr size_t count = 100000;
+			auto toLower = [](std::string_view value)
+			{
+				auto result = std::string(value);
+				for (auto& character : result)
+					character = static_cast<char>(std::tolower(static_cast<unsigned char>(character)));
+				return result;
+			};
+
+			auto loweredMap = PathMap<size_t>();
+			auto insensitiveMap = PathMap<size_t, PathCaseInsensitiveHash, PathCaseInsensitiveEqual>();
+			auto queries = std::vector<Path>();
+			for (auto i = 0u; i < count; i++)
+			{
+				auto value = files[i].ToStringView();
+				loweredMap.Insert(Path(toLower(value)), i);
+				insensitiveMap.Insert(files[i], i);
+
+				auto query = std::string(value);
+				for (auto& character : query)
+					character = static_cast<char>(std::toupper(static_cast<unsigned char>(character)));
+				queries.push_back(Path(query));
+			}
+
+			auto lookupLowered = [&](const Path& query)
+			{
+				const size_t* value;
+				return loweredMap.TryGet(Path(toLower(query.ToStringView())), value) ? *value : 0;
+			};
+
+			auto lookupInsensitive = [&](const Path& query)
+			{
+				const size_t* value;
+				return insensitiveMap.TryGet(query, value) ? *value : 0;
+			};
+
+			auto bench = [&](const char* name, auto&& lookup)
+			{
+				ankerl::nanobench::Bench().batch(count).epochs(3).minEpochIterations(1).run(name, [&]
+				{
+					size_t sum = 0;
+					for (auto& query : queries)
+						sum += lookup(query);
+					ankerl::nanobench::doNotOptimizeAway(sum);
+				});
+				ReportAllocations(name, [&]
+				{
+					ankerl::nanobench::doNotOptimizeAway(lookup(queries.back()));
+				});
+			};
+
+			bench("Lookup Lowered Copy 100K", lookupLowered);
+			bench("Lookup Case Insensitive 100K", lookupInsensitive);
+		}
+
+		// Compare resolving every file against one shared base directory
+		auto relativeBase = Path("C:/Users/Me/source/repos/MyProject/out/");
+		ankerl::nanobench::Bench().batch(files.size()).epochs(3).minEpochIterations(1).run("Get Relative To 1M Paths", [&]
+		{
+			size_t size = 0;
+			for (auto& file : files)
+				size += file.GetRelativeTo(relativeBase).ToStringView().size();
+			ankerl::nanobench::doNotOptimizeAway(size);
+		});
+
+		auto resolver = RelativePathResolver(relativeBase);
+		ankerl::nanobench::Bench().batch(files.size()).epochs(3).minEpochIterations(1).run("Resolve Relative 1M Paths", [&]
+		{
+			size_t size = 0;
+			for (auto& file : files)
+				size += resolver.Resolve(file).ToStringView().size();
+			ankerl::nanobench::doNotOptimizeAway(size);
+		});
+
+		auto relativeBuffer = std::string();
+		auto relativeViews = std::vector<PathView>();
+		ankerl::nanobench::Bench().batch(files.size()).epochs(3).minEpochIterations(1).run("Resolve All Relative 1M Paths", [&]
+		{
+			resolver.ResolveAll(files, relativeBuffer, relativeViews);
+			ankerl::nanobench::doNotOptimizeAway(relativeViews);
+		});
+
+		// Compare the path trie prefix queries against range scans over an ordered map
+		auto buildTrie = [&]
+		{
+			auto trie = PathTrie<size_t>();
+			for (auto i = 0u; i < files.size(); i++)
+				trie.Insert(files[i], i);
+			return trie;
+		};
+
+		auto buildOrderedMap = [&]
+		{
+			auto map = std::map<Path, size_t>();
+			for (auto i = 0u; i < files.size(); i++)
+				map.emplace(files[i], i);
+			return map;
+		};
+
+		ReportMemory("Build 1M PathTrie", [&] { ankerl::nanobench::doNotOptimizeAway(buildTrie()); });
+		ReportMemory("Build 1M std::map", [&] { ankerl::nanobench::doNotOptimizeAway(buildOrderedMap()); });
+
+		auto trie = buildTrie();
+		auto orderedMap = buildOrderedMap();
+		auto directories = std::vector<Path>();
+		for (auto i = 0u; i < files.size(); i += 100)
+			directories.push_back(files[i].GetParent());
+
+		ankerl::nanobench::Bench().batch(directories.size()).epochs(3).minEpochIterations(1).run("Subtree Query 1M PathTrie", [&]
+		{
+			size_t sum = 0;
+			for (auto& directory : directories)
+				trie.ForEachInSubtree(directory, [&](PathView key, size_t& value) { sum += value; });
+			ankerl::nanobench::doNotOptimizeAway(sum);
+		});
+
+		ankerl::nanobench::Bench().batch(directories.size()).epochs(3).minEpochIterations(1).run("Subtree Query 1M std::map", [&]
+		{
+			size_t sum = 0;
+			for (auto& directory : directories)
+			{
+				auto prefix = directory.ToStringView();
+				for (auto entry = orderedMap.lower_bound(directory);
+					entry != orderedMap.end() && entry->first.ToStringView().starts_with(prefix);
+					++entry)
+				{
+					sum += entry->second;
+				}
+			}
+			ankerl::nanobench::doNotOptimizeAway(sum);
+		});
+
+		// Find the owning directory for every file from a set of directory keys
+		auto directoryTrie = PathTrie<size_t>();
+		auto directoryMap = std::map<Path, size_t>();
+		for (auto i = 0u; i < directories.size(); i++)
+		{
+			directoryTrie.Insert(directories[i], i);
+			directoryMap.emplace(directories[i], i);
+		}
+
+		ankerl::nanobench::Bench().batch(files.size()).epochs(3).minEpochIterations(1).run("Longest Prefix 1M PathTrie", [&]
+		{
+			size_t sum = 0;
+			for (auto& file : files)
+			{
+				const size_t* value;
+				if (directoryTrie.TryGetLongestPrefix(file, value))
+					sum += *value;
+			}
+			ankerl::nanobench::doNotOptimizeAway(sum);
+		});
+
+		ankerl::nanobench::Bench().batch(files.size()).epochs(3).minEpochIterations(1).run("Longest Prefix 1M std::map", [&]
+		{
+			size_t sum = 0;
+			for (auto& file : files)
+			{
+				// Walk up the parent directories until one is found
+				auto directory = file;
+				while (true)
+				{
+					auto entry = directoryMap.find(directory);
+					if (entry != directoryMap.end())
+					{
+						sum += entry->second;
+						break;
+					}
+
+					auto parent = directory.GetParent();
+					if (parent == directory)
+						break;
+					directory = std::move(parent);
+				}
+			}
+			ankerl::nanobench::doNotOptimizeAway(sum);
+		});
+	}
+
 	{
 		auto uut = System::STLFileSystem();
 		ankerl::nanobench::Bench().minEpochIterations(10000).run("Get User Profile Directory", [&]
@@ -98,6 +959,32 @@ int main()
 		});
 	}
 
+	{
+		auto uut = SemanticVersion(1, 2, 3);
+		ankerl::nanobench::Bench().minEpochIterations(100000).run("SemanticVersion FormatTo Buffer With Minor and Path", [&]
+		{
+			std::array<char, SemanticVersion::MaxFormatSize> buffer;
+			auto e = uut.FormatTo(buffer.data());
+			ankerl::nanobench::doNotOptimizeAway(e);
+		});
+	}
+
+	{
+		// Append to a reused line the way a log or lock file writer would
+		auto uut = SemanticVersion(1, 2, 3);
+		auto line = std::string();
+		auto operation = [&]
+		{
+			line.clear();
+			line.append("Version = ");
+			uut.FormatTo(std::back_inserter(line));
+			ankerl::nanobench::doNotOptimizeAway(line);
+		};
+
+		ankerl::nanobench::Bench().minEpochIterations(100000).run("SemanticVersion FormatTo Line With Minor and Path", operation);
+		ReportAllocations("SemanticVersion FormatTo Line With Minor and Path", operation);
+	}
+
 	{
 		ankerl::nanobench::Bench().minEpochIterations(100000).run("SemanticVersion Parse Major Only", [&]
 		{
@@ -121,4 +1008,278 @@ int main()
 			ankerl::nanobench::doNotOptimizeAway(e);
 		});
 	}
+
+	{
+		// Parse from a string so the value is not folded into the inlined parser
+		auto value = std::string("1");
+		ankerl::nanobench::Bench().minEpochIterations(100000).run("PackedSemanticVersion Parse Major Only", [&]
+		{
+			auto e = PackedSemanticVersion::Parse(value);
+			ankerl::nanobench::doNotOptimizeAway(e);
+		});
+	}
+
+	{
+		// Parse from a string so the value is not folded into the inlined parser
+		auto value = std::string("1.2");
+		ankerl::nanobench::Bench().minEpochIterations(100000).run("PackedSemanticVersion Parse With Minor", [&]
+		{
+			auto e = PackedSemanticVersion::Parse(value);
+			ankerl::nanobench::doNotOptimizeAway(e);
+		});
+	}
+
+	{
+		// Parse from a string so the value is not folded into the inlined parser
+		auto value = std::string("1.2.3");
+		ankerl::nanobench::Bench().minEpochIterations(100000).run("PackedSemanticVersion Parse With Minor and Path", [&]
+		{
+			auto e = PackedSemanticVersion::Parse(value);
+			ankerl::nanobench::doNotOptimizeAway(e);
+		});
+	}
+
+	// Compare parsing a large list of versions one at a time against the batch parser
+	{
+		auto content = std::string();
+		uint32_t seed = 12345;
+		for (auto i = 0; i < 100000; i++)
+		{
+			seed = seed * 1664525 + 1013904223;
+			content += std::to_string((seed >> 8) % 20);
+			content += '.';
+			content += std::to_string((seed >> 16) % 50);
+			content += '.';
+			content += std::to_string((seed >> 24) % 1000);
+			content += '\n';
+		}
+
+		auto values = std::vector<std::string_view>();
+		size_t lineStart = 0;
+		for (auto lineEnd = content.find('\n'); lineEnd != std::string::npos; lineEnd = content.find('\n', lineStart))
+		{
+			values.push_back(std::string_view(content).substr(lineStart, lineEnd - lineStart));
+			lineStart = lineEnd + 1;
+		}
+
+		ankerl::nanobench::Bench().batch(values.size()).minEpochIterations(10).run("Parse 100K Versions SemanticVersion::Parse", [&]
+		{
+			auto results = std::vector<SemanticVersion>(values.size());
+			for (auto i = 0u; i < values.size(); i++)
+				results[i] = SemanticVersion::Parse(values[i]);
+			ankerl::nanobench::doNotOptimizeAway(results);
+		});
+
+		ankerl::nanobench::Bench().batch(values.size()).minEpochIterations(10).run("Parse 100K Versions PackedSemanticVersion::ParseMany", [&]
+		{
+			auto results = std::vector<PackedSemanticVersion>(values.size());
+			PackedSemanticVersion::ParseMany(values, results);
+			ankerl::nanobench::doNotOptimizeAway(results);
+		});
+
+		ankerl::nanobench::Bench().batch(values.size()).minEpochIterations(10).run("Parse 100K Versions PackedSemanticVersion::ParseMany Lines", [&]
+		{
+			auto results = std::vector<PackedSemanticVersion>();
+			results.reserve(values.size());
+			PackedSemanticVersion::ParseMany(content, results);
+			ankerl::nanobench::doNotOptimizeAway(results);
+		});
+	}
+
+	// Compare resolving versions from a catalog of 100K package versions by scanning every version against the index
+	{
+		// Build a catalog of 1K packages with 100 versions each in a shuffled order
+		auto entries = std::vector<std::pair<std::string, SemanticVersion>>();
+		for (auto i = 0; i < 1000; i++)
+		{
+			auto package = "Owner|Package" + std::to_string(i);
+			for (auto j = 0; j < 100; j++)
+				entries.emplace_back(package, SemanticVersion(j / 25, (j / 5) % 5, j % 5));
+		}
+
+		uint32_t seed = 54321;
+		for (auto i = entries.size() - 1; i > 0; i--)
+		{
+			seed = seed * 1664525 + 1013904223;
+			std::swap(entries[i], entries[seed % (i + 1)]);
+		}
+
+		auto catalog = std::string();
+		for (auto& [package, version] : entries)
+			catalog.append(std::format("{}@{}\n", package, version.ToString()));
+
+		auto queries = std::vector<std::pair<std::string, SemanticVersion>>();
+		for (auto i = 0; i < 100000; i++)
+		{
+			seed = seed * 1664525 + 1013904223;
+			queries.emplace_back("Owner|Package" + std::to_string(seed % 1000), SemanticVersion((seed >> 10) % 4, (seed >> 14) % 5));
+		}
+
+		auto loadLinear = [&]
+		{
+			auto packages = std::unordered_map<std::string, std::vector<SemanticVersion>>();
+			auto value = std::string_view(catalog);
+			size_t current = 0;
+			size_t next = 0;
+			while ((next = value.find('\n', current)) != std::string_view::npos)
+			{
+				auto line = value.substr(current, next - current);
+				auto separator = line.rfind('@');
+				packages[std::string(line.substr(0, separator))].push_back(SemanticVersion::Parse(line.substr(separator + 1)));
+				current = next + 1;
+			}
+
+			return packages;
+		};
+
+		auto loadIndex = [&]
+		{
+			auto index = VersionIndex();
+			index.Load(catalog);
+			return index;
+		};
+
+		ankerl::nanobench::Bench().batch(entries.size()).epochs(3).minEpochIterations(1).run("Load 100K Package Versions Linear", [&]
+		{
+			auto packages = loadLinear();
+			ankerl::nanobench::doNotOptimizeAway(packages);
+		});
+
+		ankerl::nanobench::Bench().batch(entries.size()).epochs(3).minEpochIterations(1).run("Load 100K Package Versions VersionIndex", [&]
+		{
+			auto index = loadIndex();
+			ankerl::nanobench::doNotOptimizeAway(index);
+		});
+
+		auto packages = loadLinear();
+		auto index = loadIndex();
+		ankerl::nanobench::Bench().batch(queries.size()).epochs(3).minEpochIterations(1).run("Latest Compatible 100K Package Versions Linear", [&]
+		{
+			size_t found = 0;
+			for (auto& [package, minimum] : queries)
+			{
+				// Check every known version against the constraint
+				auto& versions = packages.find(package)->second;
+				const SemanticVersion* best = nullptr;
+				for (auto& version : versions)
+				{
+					if (version.GetMajor() == minimum.GetMajor() && !(version < minimum) && (best == nullptr || *best < version))
+						best = &version;
+				}
+
+				found += best != nullptr;
+			}
+			ankerl::nanobench::doNotOptimizeAway(found);
+		});
+
+		ankerl::nanobench::Bench().batch(queries.size()).epochs(3).minEpochIterations(1).run("Latest Compatible 100K Package Versions VersionIndex", [&]
+		{
+			size_t found = 0;
+			SemanticVersion result;
+			for (auto& [package, minimum] : queries)
+				found += index.TryGetLatestCompatible(package, minimum, result);
+			ankerl::nanobench::doNotOptimizeAway(found);
+		});
+
+		ankerl::nanobench::Bench().batch(queries.size()).epochs(3).minEpochIterations(1).run("Best Match 100K Package Versions VersionIndex", [&]
+		{
+			size_t found = 0;
+			SemanticVersion result;
+			for (auto& [package, reference] : queries)
+				found += index.TryGetBestMatch(package, reference, result);
+			ankerl::nanobench::doNotOptimizeAway(found);
+		});
+	}
+
+	// Compare sorting a large set of versions through the comparison operators against the packed versions
+	{
+		auto versions = std::vector<SemanticVersion>();
+		versions.reserve(1000000);
+		uint32_t seed = 12345;
+		for (auto i = 0; i < 1000000; i++)
+		{
+			seed = seed * 1664525 + 1013904223;
+			versions.push_back(SemanticVersion((seed >> 8) % 20, (seed >> 16) % 50, (seed >> 24) % 100));
+		}
+
+		auto packed = std::vector<PackedSemanticVersion>();
+		packed.reserve(versions.size());
+		for (auto& version : versions)
+			packed.push_back(PackedSemanticVersion(version));
+
+		ankerl::nanobench::Bench().batch(versions.size()).epochs(3).minEpochIterations(1).run("Sort 1M SemanticVersion std::sort", [&]
+		{
+			auto values = versions;
+			std::sort(values.begin(), values.end());
+			ankerl::nanobench::doNotOptimizeAway(values);
+		});
+
+		ankerl::nanobench::Bench().batch(versions.size()).epochs(3).minEpochIterations(1).run("Sort 1M PackedSemanticVersion std::sort", [&]
+		{
+			auto values = packed;
+			std::sort(values.begin(), values.end());
+			ankerl::nanobench::doNotOptimizeAway(values);
+		});
+
+		ankerl::nanobench::Bench().batch(versions.size()).epochs(3).minEpochIterations(1).run("Sort 1M PackedSemanticVersion Radix", [&]
+		{
+			auto values = packed;
+			PackedSemanticVersion::Sort(values);
+			ankerl::nanobench::doNotOptimizeAway(values);
+		});
+
+		ankerl::nanobench::Bench().batch(versions.size()).epochs(3).minEpochIterations(1).run("Sort 1M SemanticVersion Packed Radix", [&]
+		{
+			auto values = versions;
+			PackedSemanticVersion::Sort(values);
+			ankerl::nanobench::doNotOptimizeAway(values);
+		});
+	}
+
+	{
+		auto map = SequenceMap<std::string, int>({
+			{ "RuntimeDependencies", 1 },
+			{ "BuildDependencies", 2 },
+			{ "TestDependencies", 3 },
+		});
+		auto operation = [&]
+		{
+			const int* value;
+			map.TryGet("TestDependencies", value);
+			ankerl::nanobench::doNotOptimizeAway(value);
+		};
+		ankerl::nanobench::Bench().minEpochIterations(100000).run("SequenceMap TryGet Literal", operation);
+		ReportAllocations("SequenceMap TryGet Literal", operation);
+	}
+
+	// Compare building and searching property tables of different sizes with string keys
+	for (auto size : { 8, 16, 64, 1000 })
+	{
+		auto keys = std::vector<std::string>();
+		for (auto i = 0; i < size; i++)
+			keys.push_back("Property" + std::to_string(i));
+
+		auto name = std::to_string(size);
+		ankerl::nanobench::Bench().batch(keys.size()).minEpochIterations(10).run("SequenceMap Insert " + name + " Keys", [&]
+		{
+			auto map = SequenceMap<std::string, int>();
+			for (auto i = 0u; i < keys.size(); i++)
+				map.Insert(keys[i], static_cast<int>(i));
+			ankerl::nanobench::doNotOptimizeAway(map);
+		});
+
+		auto map = SequenceMap<std::string, int>();
+		for (auto i = 0u; i < keys.size(); i++)
+			map.Insert(keys[i], static_cast<int>(i));
+
+		ankerl::nanobench::Bench().batch(keys.size()).minEpochIterations(10).run("SequenceMap TryGet " + name + " Keys", [&]
+		{
+			for (auto& key : keys)
+			{
+				const int* value;
+				map.TryGet(key, value);
+				ankerl::nanobench::doNotOptimizeAway(value);
+			}
+		});
+	}
 }
\ No newline at end of file
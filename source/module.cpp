@@ -3,18 +3,38 @@
 #include <algorithm>
 #include <array>
 #include <atomic>
+#include <bit>
+#include <charconv>
 #include <chrono>
+#include <cstring>
+#include <deque>
 #include <functional>
 #include <fstream>
 #include <filesystem>
+#include <format>
 #include <iostream>
+#include <iterator>
+#include <limits>
 #include <locale>
 #include <map>
+#include <memory_resource>
 #include <mutex>
 #include <optional>
 #include <queue>
+#include <shared_mutex>
+#include <span>
 #include <sstream>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <immintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
 
 #if defined(_WIN32)
 
@@ -40,6 +60,9 @@
 #error Uknown Platform
 #endif
 
+// Shared with the sequence map partition, so it must be in the global module of both
+#include "utilities/hash-index.h"
+
 export module Opal;
 
 export import :SequenceMap;
@@ -47,7 +70,16 @@ export import :SequenceMap;
 #define OPAL_IMPLEMENTATION
 
 #include "utilities/path.h"
+#include "utilities/path-comparer.h"
+#include "utilities/path-list.h"
+#include "utilities/path-list-parser.h"
+#include "utilities/path-pool.h"
+#include "utilities/path-map.h"
+#include "utilities/path-trie.h"
+#include "utilities/relative-path-resolver.h"
 #include "utilities/semantic-version.h"
+#include "utilities/packed-semantic-version.h"
+#include "utilities/version-index.h"
 
 #include "io/system-console-manager.h"
 #include "io/mock-console-manager.h"
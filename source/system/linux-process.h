@@ -57,8 +57,10 @@ namespace Opal::System
 			posix_spawn_file_actions_t* fileActions = nullptr;
 			posix_spawnattr_t* attributes = nullptr;
 
+			// Note: Keep the executable string alive until the process has been spawned
+			auto executable = m_executable.ToString();
 			std::vector<const char*> arguments;
-			arguments.push_back(m_executable.ToString().c_str());
+			arguments.push_back(executable.c_str());
 			for (auto& argument : m_arguments)
 				arguments.push_back(argument.c_str());
 			arguments.push_back(nullptr);
@@ -74,7 +76,7 @@ namespace Opal::System
 			pid_t processId;
 			auto status = posix_spawn(
 				&processId,
-				m_executable.ToString().c_str(),
+				executable.c_str(),
 				fileActions,
 				attributes,
 				const_cast<char**>(arguments.data()),
@@ -11,20 +11,22 @@ namespace Opal::System
 {
 	/// <summary>
 	/// The mock file system
+	/// The hash and equality policies select how the requested paths match the mock files and directories.
 	/// TODO: Move into test project
 	/// </summary>
-	export class MockFileSystem : public IFileSystem
+	export template<typename THash, typename TEqual>
+	class BasicMockFileSystem : public IFileSystem
 	{
 	private:
 		std::vector<std::string> _requests;
-		std::map<Path, std::shared_ptr<MockDirectory>> _directories;
-		std::map<Path, std::shared_ptr<MockFile>> _files;
+		PathMap<std::shared_ptr<MockDirectory>, THash, TEqual> _directories;
+		PathMap<std::shared_ptr<MockFile>, THash, TEqual> _files;
 
 	public:
 		/// <summary>
-		/// Initializes a new instance of the <see cref='MockFileSystem'/> class.
+		/// Initializes a new instance of the <see cref='BasicMockFileSystem'/> class.
 		/// </summary>
-		MockFileSystem() :
+		BasicMockFileSystem() :
 			_requests(),
 			_directories(),
 			_files()
@@ -44,7 +46,7 @@ namespace Opal::System
 		/// </summary>
 		void CreateMockDirectory(Path path, std::shared_ptr<MockDirectory> directory)
 		{
-			_directories.emplace(
+			_directories.TryInsert(
 				std::move(path),
 				std::move(directory));
 		}
@@ -54,7 +56,7 @@ namespace Opal::System
 		/// </summary>
 		void CreateMockFile(Path path, std::shared_ptr<MockFile> file)
 		{
-			_files.emplace(
+			_files.TryInsert(
 				std::move(path),
 				std::move(file));
 		}
@@ -64,10 +66,10 @@ namespace Opal::System
 		/// </summary>
 		std::shared_ptr<MockFile> GetMockFile(Path path)
 		{
-			auto file = _files.find(path);
-			if (file != _files.end())
+			std::shared_ptr<MockFile>* file;
+			if (_files.TryGet(path, file))
 			{
-				return file->second;
+				return *file;
 			}
 			else
 			{
@@ -83,7 +85,7 @@ namespace Opal::System
 		{
 			_requests.push_back("GetCurrentDirectory");
 
-			return Path("C:/Users/Me/");
+			return Path("C:/Users/Me/"_path);
 		}
 
 		/// <summary>
@@ -93,7 +95,7 @@ namespace Opal::System
 		{
 			_requests.push_back("GetCurrentDirectory");
 
-			return Path("C:/Current/");
+			return Path("C:/Current/"_path);
 		}
 
 		/// <summary>
@@ -107,13 +109,11 @@ namespace Opal::System
 
 			if (path.HasFileName())
 			{
-				auto file = _files.find(path);
-				return file != _files.end();
+				return _files.Contains(path);
 			}
 			else
 			{
-				auto directory = _directories.find(path);
-				return directory != _directories.end();
+				return _directories.Contains(path);
 			}
 		}
 
@@ -126,10 +126,10 @@ namespace Opal::System
 			message << "TryGetLastWriteTime: " << path.ToString();
 			_requests.push_back(message.str());
 
-			auto file = _files.find(path);
-			if (file != _files.end())
+			std::shared_ptr<MockFile>* file;
+			if (_files.TryGet(path, file))
 			{
-				value = file->second->LastWriteTime;
+				value = (*file)->LastWriteTime;
 				return true;
 			}
 			else
@@ -149,18 +149,18 @@ namespace Opal::System
 			message << "TryGetDirectoryFilesLastWriteTime: " << path.ToString();
 			_requests.push_back(message.str());
 
-			auto directory = _directories.find(path);
-			if (directory == _directories.end())
+			std::shared_ptr<MockDirectory>* directory;
+			if (!_directories.TryGet(path, directory))
 			{
 				return false;
 			}
 			else
 			{
-				callback(Path("./"), directory->second->LastWriteTime);
+				callback(Path("./"_path), (*directory)->LastWriteTime);
 
-				for (auto& child : directory->second->Children)
+				for (auto& child : (*directory)->Children)
 				{
-					callback(child, directory->second->LastWriteTime);
+					callback(child, (*directory)->LastWriteTime);
 				}
 
 				return true;
@@ -193,13 +193,13 @@ namespace Opal::System
 			}
 			_requests.push_back(message.str());
 
-			auto file = _files.find(path);
-			if (file != _files.end())
+			std::shared_ptr<MockFile>* file;
+			if (_files.TryGet(path, file))
 			{
 				// Reset the existing content offset and return it.
-				auto& content = file->second->Content;
+				auto& content = (*file)->Content;
 				content.seekg(0, std::ios_base::beg);
-				result = std::make_shared<MockInputFile>(file->second);
+				result = std::make_shared<MockInputFile>(*file);
 				return true;
 			}
 			else
@@ -222,13 +222,13 @@ namespace Opal::System
 			}
 			_requests.push_back(message.str());
 
-			auto file = _files.find(path);
-			if (file != _files.end())
+			std::shared_ptr<MockFile>* file;
+			if (_files.TryGet(path, file))
 			{
 				// Reset the existing content offset and return it.
-				auto& content = file->second->Content;
+				auto& content = (*file)->Content;
 				content.seekg(0);
-				return std::make_shared<MockInputFile>(file->second);
+				return std::make_shared<MockInputFile>(*file);
 			}
 			else
 			{
@@ -253,20 +253,20 @@ namespace Opal::System
 			}
 			_requests.push_back(message.str());
 
-			auto file = _files.find(path);
-			if (file != _files.end())
+			std::shared_ptr<MockFile>* file;
+			if (_files.TryGet(path, file))
 			{
 				// Reset the existing content offset and return it.
-				auto& content = file->second->Content;
+				auto& content = (*file)->Content;
 				content.str("");
 				content.clear();
-				return std::make_shared<MockOutputFile>(file->second);
+				return std::make_shared<MockOutputFile>(*file);
 			}
 			else
 			{
 				// Create the file if it does not exist
-				auto insert = _files.emplace(path, std::make_shared<MockFile>());
-				return std::make_shared<MockOutputFile>(insert.first->second);
+				auto [wasInserted, insertedFile] = _files.TryInsert(path, std::make_shared<MockFile>());
+				return std::make_shared<MockOutputFile>(*insertedFile);
 			}
 		}
 
@@ -328,4 +328,18 @@ namespace Opal::System
 			_requests.push_back(message.str());
 		}
 	};
+
+	/// <summary>
+	/// The mock file system with exact path matching
+	/// </summary>
+	export class MockFileSystem : public BasicMockFileSystem<PathHash, PathEqual>
+	{
+	};
+
+	/// <summary>
+	/// The mock file system that matches paths ignoring the case of ASCII letters, the same as Windows
+	/// </summary>
+	export class CaseInsensitiveMockFileSystem : public BasicMockFileSystem<PathCaseInsensitiveHash, PathCaseInsensitiveEqual>
+	{
+	};
 }
@@ -29,8 +29,8 @@ namespace Opal::System
 		/// </summary>
 		std::shared_ptr<MockLibrary> RegisterLibrary(Path path)
 		{
-			auto library = std::make_shared<MockLibrary>(path.ToString(), _requests);
-			_libraries.emplace(
+			auto library = std::make_shared<MockLibrary>(std::string(path.ToStringView()), _requests);
+			_libraries.TryInsert(
 				std::move(path),
 				library);
 
@@ -56,10 +56,10 @@ namespace Opal::System
 
 			_requests.push_back(message.str());
 
-			auto library = _libraries.find(path);
-			if (library != _libraries.end())
+			std::shared_ptr<MockLibrary>* library;
+			if (_libraries.TryGet(path, library))
 			{
-				return library->second;
+				return *library;
 			}
 			else
 			{
@@ -69,7 +69,7 @@ namespace Opal::System
 		}
 
 	private:
-		std::map<Path, std::shared_ptr<MockLibrary>> _libraries;
+		PathMap<std::shared_ptr<MockLibrary>> _libraries;
 		std::vector<std::string> _requests;
 	};
 }
@@ -21,7 +21,7 @@ namespace Opal::System
 		MockProcessManager() :
 			m_uniqueId(1),
 			_requests(),
-			_processFileName(Path("C:/testlocation/SoupCMDTest.exe")),
+			_processFileName(Path("C:/testlocation/SoupCMDTest.exe"_path)),
 			_executeResults(),
 			_executeCallbacks()
 		{
@@ -67,7 +67,7 @@ namespace Opal::System
 		/// </summary>
 		bool Exists(const Path& path) override final
 		{
-			return std::filesystem::exists(path.ToString());
+			return std::filesystem::exists(path.ToStringView());
 		}
 
 		/// <summary>
@@ -95,7 +95,7 @@ namespace Opal::System
 				}
 			#else
 				std::error_code error;
-				auto fileTime = std::filesystem::last_write_time(path.ToString(), error);
+				auto fileTime = std::filesystem::last_write_time(path.ToStringView(), error);
 				if (error)
 				{
 					return false;
@@ -177,7 +177,7 @@ namespace Opal::System
 				return true;
 			#else
 				// Standard implementation
-				auto directoryPath = std::filesystem::path(path.ToString());
+				auto directoryPath = std::filesystem::path(path.ToStringView());
 				if (!std::filesystem::exists(directoryPath))
 				{
 					return false;
@@ -208,7 +208,7 @@ namespace Opal::System
 		/// </summary>
 		void SetLastWriteTime(const Path& path, std::filesystem::file_time_type value) override final
 		{
-			std::filesystem::last_write_time(path.ToString(), value);
+			std::filesystem::last_write_time(path.ToStringView(), value);
 		}
 
 		/// <summary>
@@ -222,7 +222,7 @@ namespace Opal::System
 				mode = static_cast<std::ios_base::openmode>(mode | std::fstream::binary);
 			}
 
-			auto file = std::ifstream(path.ToString(), mode);
+			auto file = std::ifstream(std::filesystem::path(path.ToStringView()), mode);
 			if (file.fail())
 			{
 				result = nullptr;
@@ -243,7 +243,7 @@ namespace Opal::System
 				mode = static_cast<std::ios_base::openmode>(mode | std::fstream::binary);
 			}
 
-			auto file = std::ifstream(path.ToString(), mode);
+			auto file = std::ifstream(std::filesystem::path(path.ToStringView()), mode);
 			if (file.fail())
 			{
 				auto message = "OpenRead Failed: File missing. " + path.ToString();
@@ -264,7 +264,7 @@ namespace Opal::System
 				mode = static_cast<std::ios_base::openmode>(mode | std::fstream::binary);
 			}
 
-			auto file = std::ofstream(path.ToString(), mode);
+			auto file = std::ofstream(std::filesystem::path(path.ToStringView()), mode);
 			if (file.fail())
 			{
 				auto message = "OpenWrite Failed: " + path.ToString();
@@ -280,8 +280,8 @@ namespace Opal::System
 		virtual void Rename(const Path& source, const Path& destination) override final
 		{
 			std::filesystem::rename(
-				source.ToString(),
-				destination.ToString());
+				source.ToStringView(),
+				destination.ToStringView());
 		}
 
 		/// <summary>
@@ -290,8 +290,8 @@ namespace Opal::System
 		void CopyFile(const Path& source, const Path& destination) override final
 		{
 			std::filesystem::copy(
-				source.ToString(),
-				destination.ToString(),
+				source.ToStringView(),
+				destination.ToStringView(),
 				std::filesystem::copy_options::overwrite_existing);
 		}
 
@@ -300,7 +300,7 @@ namespace Opal::System
 		/// </summary>
 		void CreateDirectory(const Path& path) override final
 		{
-			std::filesystem::create_directories(path.ToString());
+			std::filesystem::create_directories(path.ToStringView());
 		}
 
 		/// <summary>
@@ -309,7 +309,7 @@ namespace Opal::System
 		std::vector<DirectoryEntry> GetDirectoryChildren(const Path& path) override final
 		{
 			auto result = std::vector<DirectoryEntry>();
-			for(auto& child : std::filesystem::directory_iterator(path.ToString()))
+			for(auto& child : std::filesystem::directory_iterator(path.ToStringView()))
 			{
 				auto directoryEntry = DirectoryEntry();
 				directoryEntry.Path = Path(child.path().string());
@@ -343,11 +343,11 @@ namespace Opal::System
 		{
 			if (recursive)
 			{
-				std::filesystem::remove_all(path.ToString());
+				std::filesystem::remove_all(path.ToStringView());
 			}
 			else
 			{
-				std::filesystem::remove(path.ToString());
+				std::filesystem::remove(path.ToStringView());
 			}
 		}
 	};
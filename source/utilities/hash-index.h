@@ -0,0 +1,164 @@
+﻿// <copyright file="hash-index.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+#pragma once
+
+namespace Opal
+{
+	/// <summary>
+	/// An open addressing index from key hashes to the positions of entries in a dense list
+	/// Uses linear probing and compares the stored hash before calling back to compare the key.
+	/// Note: Each slot only keeps the low half of the hash to keep the index small, which is enough
+	/// to find the ideal slot for any table that fits the 32 bit positions.
+	/// </summary>
+	class HashIndex
+	{
+	public:
+		static constexpr size_t NotFound = std::numeric_limits<size_t>::max();
+
+	private:
+		struct Slot
+		{
+			uint32_t Hash;
+
+			// The entry position plus one, zero marks an empty slot
+			uint32_t Position;
+		};
+
+		std::vector<Slot> _slots;
+		size_t _mask;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref="HashIndex"/> class.
+		/// </summary>
+		HashIndex() noexcept :
+			_slots(),
+			_mask(0)
+		{
+		}
+
+		/// <summary>
+		/// Gets a value indicating whether the index has been sized to hold any entries
+		/// </summary>
+		bool IsAllocated() const noexcept
+		{
+			return !_slots.empty();
+		}
+
+		/// <summary>
+		/// Gets a value indicating whether the index must grow before holding the requested number of entries
+		/// Note: Keeps the load at or below three quarters to keep the probe sequences short
+		/// </summary>
+		bool NeedsGrowth(size_t count) const noexcept
+		{
+			return count * 4 > _slots.size() * 3;
+		}
+
+		/// <summary>
+		/// Find the slot that references the entry matching the hash and predicate
+		/// </summary>
+		template<typename TMatches>
+		size_t FindSlot(size_t hash, TMatches&& matches) const
+		{
+			if (_slots.empty())
+				return NotFound;
+
+			auto shortHash = static_cast<uint32_t>(hash);
+			for (auto slot = hash & _mask; ; slot = (slot + 1) & _mask)
+			{
+				const auto& current = _slots[slot];
+				if (current.Position == 0)
+					return NotFound;
+				if (current.Hash == shortHash && matches(current.Position - 1))
+					return slot;
+			}
+		}
+
+		/// <summary>
+		/// Gets the entry position referenced by a slot
+		/// </summary>
+		size_t GetPosition(size_t slot) const noexcept
+		{
+			return _slots[slot].Position - 1;
+		}
+
+		/// <summary>
+		/// Add a new entry, the caller is responsible for growing the index first
+		/// </summary>
+		void Insert(size_t hash, size_t position)
+		{
+			if (position >= std::numeric_limits<uint32_t>::max())
+				throw std::runtime_error("Hash index position overflow");
+
+			auto slot = hash & _mask;
+			while (_slots[slot].Position != 0)
+				slot = (slot + 1) & _mask;
+
+			_slots[slot] = { static_cast<uint32_t>(hash), static_cast<uint32_t>(position + 1) };
+		}
+
+		/// <summary>
+		/// Remove the slot and shift back any following entries that belong before it
+		/// </summary>
+		void Erase(size_t slot) noexcept
+		{
+			auto hole = slot;
+			for (auto current = (hole + 1) & _mask; _slots[current].Position != 0; current = (current + 1) & _mask)
+			{
+				// An entry can fill the hole when the hole is between its ideal slot and the current slot
+				auto ideal = _slots[current].Hash & _mask;
+				if (((current - ideal) & _mask) >= ((current - hole) & _mask))
+				{
+					_slots[hole] = _slots[current];
+					hole = current;
+				}
+			}
+
+			_slots[hole] = { 0, 0 };
+		}
+
+		/// <summary>
+		/// Update the slot for an entry that moved to a new position
+		/// </summary>
+		void Move(size_t hash, size_t from, size_t to) noexcept
+		{
+			auto slot = FindSlot(hash, [&](size_t position) { return position == from; });
+			_slots[slot].Position = static_cast<uint32_t>(to + 1);
+		}
+
+		/// <summary>
+		/// Move every entry after the position down by one, for a list that kept its order while erasing the position
+		/// </summary>
+		void ShiftDown(size_t position) noexcept
+		{
+			for (auto& slot : _slots)
+			{
+				if (slot.Position > position + 1)
+					slot.Position--;
+			}
+		}
+
+		/// <summary>
+		/// Resize to fit the requested number of entries and re-add all existing entries
+		/// Note: Uses the stored hashes so the entries themselves are never touched
+		/// </summary>
+		void Rebuild(size_t capacity)
+		{
+			auto size = std::bit_ceil(std::max<size_t>(8, (capacity * 4 + 2) / 3));
+			auto previousSlots = std::move(_slots);
+			_slots = std::vector<Slot>(size, { 0, 0 });
+			_mask = size - 1;
+			for (const auto& slot : previousSlots)
+			{
+				if (slot.Position != 0)
+					Insert(slot.Hash, slot.Position - 1);
+			}
+		}
+
+		void Clear() noexcept
+		{
+			std::fill(_slots.begin(), _slots.end(), Slot({ 0, 0 }));
+		}
+	};
+}
@@ -0,0 +1,484 @@
+﻿// <copyright file="packed-semantic-version.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+#pragma once
+#include "path-scan.h"
+#include "semantic-version.h"
+
+namespace Opal
+{
+	/// <summary>
+	/// A semantic version packed into a single 64 bit integer
+	/// LAYOUT: major (22 bits), minor (20 bits), patch (20 bits), has minor, has patch
+	/// The values are stored from most to least significant so the versions order the same as the
+	/// integers with the presence bits shifted out. A missing minor or patch is stored as zero, which
+	/// matches the comparisons of <see cref="SemanticVersion"/>.
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	class PackedSemanticVersion
+	{
+	private:
+		static constexpr uint64_t HasPatchFlag = 0x1;
+		static constexpr uint64_t HasMinorFlag = 0x2;
+		static constexpr uint32_t PresenceBits = 2;
+		static constexpr uint32_t PatchBits = 20;
+		static constexpr uint32_t MinorBits = 20;
+		static constexpr uint32_t MajorBits = 22;
+		static constexpr uint32_t PatchShift = PresenceBits;
+		static constexpr uint32_t MinorShift = PatchShift + PatchBits;
+		static constexpr uint32_t MajorShift = MinorShift + MinorBits;
+
+		// Smaller lists are sorted with a comparison sort since the radix histograms are not free
+		static constexpr size_t RadixSortThreshold = 256;
+
+		// Every value that fits in the packed range has at most seven digits
+		static constexpr size_t MaxDigits = 7;
+
+		// Lines up to a single vector register are classified in one pass
+		static constexpr size_t VectorParseSize = 16;
+
+	public:
+		static constexpr int MaxMajor = (1 << MajorBits) - 1;
+		static constexpr int MaxMinor = (1 << MinorBits) - 1;
+		static constexpr int MaxPatch = (1 << PatchBits) - 1;
+
+		/// <summary>
+		/// Try to pack the version, which fails if any value is negative or too large to fit
+		/// </summary>
+		static bool TryCreate(const SemanticVersion& version, PackedSemanticVersion& result) noexcept
+		{
+			auto minor = version.GetMinorOrDefault();
+			auto patch = version.GetPatchOrDefault();
+			if (version.GetMajor() < 0 || version.GetMajor() > MaxMajor ||
+				minor < 0 || minor > MaxMinor ||
+				patch < 0 || patch > MaxPatch)
+			{
+				result = PackedSemanticVersion();
+				return false;
+			}
+
+			result._value =
+				static_cast<uint64_t>(version.GetMajor()) << MajorShift |
+				static_cast<uint64_t>(minor) << MinorShift |
+				static_cast<uint64_t>(patch) << PatchShift |
+				(version.HasMinor() ? HasMinorFlag : 0) |
+				(version.HasPatch() ? HasPatchFlag : 0);
+			return true;
+		}
+
+		/// <summary>
+		/// Try parse the value straight into a packed version
+		/// Unlike <see cref="SemanticVersion::TryParse"/> the value must be one to three dot separated
+		/// decimal values with nothing else, so signs, trailing text and out of range values all fail.
+		/// </summary>
+		static bool TryParse(std::string_view value, PackedSemanticVersion& result) noexcept
+		{
+			std::array<uint32_t, 3> values = {};
+			size_t valueCount = 1;
+			size_t digitCount = 0;
+			for (auto current : value)
+			{
+				if (current == '.')
+				{
+					if (digitCount == 0 || valueCount == values.size())
+						return false;
+
+					valueCount++;
+					digitCount = 0;
+				}
+				else if (current >= '0' && current <= '9')
+				{
+					if (++digitCount > MaxDigits)
+						return false;
+
+					values[valueCount - 1] = values[valueCount - 1] * 10 + static_cast<uint32_t>(current - '0');
+				}
+				else
+				{
+					return false;
+				}
+			}
+
+			if (digitCount == 0)
+				return false;
+
+			return TryPack(values[0], values[1], values[2], valueCount, result);
+		}
+
+		/// <summary>
+		/// Parse the value straight into a packed version
+		/// </summary>
+		static PackedSemanticVersion Parse(std::string_view value)
+		{
+			PackedSemanticVersion result;
+			if (TryParse(value, result))
+				return result;
+			else
+				throw std::runtime_error("Invalid semantic version");
+		}
+
+		/// <summary>
+		/// Parse every value into the matching result
+		/// </summary>
+		static void ParseMany(std::span<const std::string_view> values, std::span<PackedSemanticVersion> results)
+		{
+			if (values.size() != results.size())
+				throw std::runtime_error("The results must be the same size as the values");
+
+			for (size_t i = 0; i < values.size(); i++)
+			{
+				if (!TryParse(values[i], results[i]))
+					throw std::runtime_error(std::format("Invalid semantic version: {}", values[i]));
+			}
+		}
+
+		/// <summary>
+		/// Parse a buffer with one version per line, appending the results
+		/// Each line is classified as a single block of digits and dots read straight from the buffer and
+		/// every value is converted eight digits at a time, so there is no branch per character.
+		/// Empty lines are skipped and Windows line endings are allowed.
+		/// </summary>
+		static void ParseMany(std::string_view content, std::vector<PackedSemanticVersion>& results)
+		{
+			size_t lineStart = 0;
+			auto parseLine = [&](size_t lineEnd)
+			{
+				auto line = content.substr(lineStart, lineEnd - lineStart);
+				lineStart = lineEnd + 1;
+				if (!line.empty() && line.back() == '\r')
+					line.remove_suffix(1);
+				if (line.empty())
+					return;
+
+				// Read the whole block straight from the buffer while it extends far enough past the line
+				PackedSemanticVersion version;
+				#ifdef OPAL_PATH_SCAN_X64
+				auto lineOffset = static_cast<size_t>(line.data() - content.data());
+				auto isValid = line.size() <= VectorParseSize && content.size() - lineOffset >= VectorParseSize ?
+					TryParseBlock(line.data(), static_cast<uint32_t>(line.size()), version) :
+					TryParse(line, version);
+				#else
+				auto isValid = TryParse(line, version);
+				#endif
+
+				if (!isValid)
+					throw std::runtime_error(std::format("Invalid semantic version: {}", line));
+
+				results.push_back(version);
+			};
+
+			PathScan::ForEachMatch(content, '\n', '\n', parseLine);
+			if (lineStart < content.size())
+				parseLine(content.size());
+		}
+
+		/// <summary>
+		/// Sort the versions with a stable least significant digit radix sort over the packed integers
+		/// Note: The digits that are the same for every version are skipped, so lists where only a few
+		/// values change take only a few passes
+		/// </summary>
+		static void Sort(std::span<PackedSemanticVersion> values)
+		{
+			SortBy(values, [](const PackedSemanticVersion& value) { return value; });
+		}
+
+		/// <summary>
+		/// Stable sort any values by the packed version of each value with the same radix sort
+		/// </summary>
+		template<typename T, typename TGetVersion>
+		static void SortBy(std::span<T> values, TGetVersion&& getVersion)
+		{
+			if (values.size() < RadixSortThreshold)
+			{
+				std::stable_sort(values.begin(), values.end(), [&](const T& left, const T& right)
+				{
+					return getVersion(left) < getVersion(right);
+				});
+				return;
+			}
+
+			constexpr uint32_t DigitBits = 8;
+			constexpr uint32_t DigitCount = (64 - PresenceBits + DigitBits - 1) / DigitBits;
+			constexpr size_t BucketCount = size_t(1) << DigitBits;
+			constexpr uint64_t DigitMask = BucketCount - 1;
+
+			// Count every digit in a single pass
+			std::array<std::array<size_t, BucketCount>, DigitCount> counts = {};
+			for (auto& value : values)
+			{
+				auto key = getVersion(value).GetKey();
+				for (auto digit = 0u; digit < DigitCount; digit++)
+					counts[digit][(key >> (digit * DigitBits)) & DigitMask]++;
+			}
+
+			auto buffer = std::vector<T>(values.size());
+			auto source = values.data();
+			auto target = buffer.data();
+			for (auto digit = 0u; digit < DigitCount; digit++)
+			{
+				auto shift = digit * DigitBits;
+				auto& digitCounts = counts[digit];
+				if (digitCounts[(getVersion(source[0]).GetKey() >> shift) & DigitMask] == values.size())
+					continue;
+
+				size_t offset = 0;
+				for (auto& count : digitCounts)
+				{
+					auto current = count;
+					count = offset;
+					offset += current;
+				}
+
+				for (size_t i = 0; i < values.size(); i++)
+					target[digitCounts[(getVersion(source[i]).GetKey() >> shift) & DigitMask]++] = source[i];
+
+				std::swap(source, target);
+			}
+
+			if (source != values.data())
+				std::copy(source, source + values.size(), values.data());
+		}
+
+		/// <summary>
+		/// Sort the versions through their packed values
+		/// Note: Falls back to a comparison sort if any version cannot be packed
+		/// </summary>
+		static void Sort(std::span<SemanticVersion> values)
+		{
+			auto packed = std::vector<PackedSemanticVersion>(values.size());
+			for (size_t i = 0; i < values.size(); i++)
+			{
+				if (!TryCreate(values[i], packed[i]))
+				{
+					std::stable_sort(values.begin(), values.end());
+					return;
+				}
+			}
+
+			Sort(std::span<PackedSemanticVersion>(packed));
+			for (size_t i = 0; i < values.size(); i++)
+				values[i] = packed[i].ToSemanticVersion();
+		}
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref="PackedSemanticVersion"/> class.
+		/// </summary>
+		constexpr PackedSemanticVersion() noexcept :
+			_value(0)
+		{
+		}
+
+		explicit PackedSemanticVersion(const SemanticVersion& version) :
+			_value(0)
+		{
+			if (!TryCreate(version, *this))
+				throw std::runtime_error("Semantic version is out of range for a packed version");
+		}
+
+		PackedSemanticVersion(int major, std::optional<int> minor = std::nullopt, std::optional<int> patch = std::nullopt) :
+			PackedSemanticVersion(SemanticVersion(major, minor, patch))
+		{
+		}
+
+		/// <summary>
+		/// Gets the packed integer value, including the presence bits
+		/// </summary>
+		constexpr uint64_t GetValue() const noexcept
+		{
+			return _value;
+		}
+
+		/// <summary>
+		/// Gets the version major
+		/// </summary>
+		constexpr int GetMajor() const noexcept
+		{
+			return static_cast<int>(_value >> MajorShift);
+		}
+
+		/// <summary>
+		/// Gets the version minor
+		/// </summary>
+		constexpr bool HasMinor() const noexcept
+		{
+			return (_value & HasMinorFlag) != 0;
+		}
+		int GetMinor() const
+		{
+			if (!HasMinor())
+				throw std::runtime_error("Semantic version does not have a minor value");
+			return GetMinorOrDefault();
+		}
+		constexpr int GetMinorOrDefault() const noexcept
+		{
+			return static_cast<int>((_value >> MinorShift) & MaxMinor);
+		}
+
+		/// <summary>
+		/// Gets the version patch
+		/// </summary>
+		constexpr bool HasPatch() const noexcept
+		{
+			return (_value & HasPatchFlag) != 0;
+		}
+		int GetPatch() const
+		{
+			if (!HasPatch())
+				throw std::runtime_error("Semantic version does not have a patch value");
+			return GetPatchOrDefault();
+		}
+		constexpr int GetPatchOrDefault() const noexcept
+		{
+			return static_cast<int>((_value >> PatchShift) & MaxPatch);
+		}
+
+		/// <summary>
+		/// Unpack the version
+		/// </summary>
+		SemanticVersion ToSemanticVersion() const
+		{
+			return SemanticVersion(
+				GetMajor(),
+				HasMinor() ? std::optional<int>(GetMinorOrDefault()) : std::nullopt,
+				HasPatch() ? std::optional<int>(GetPatchOrDefault()) : std::nullopt);
+		}
+
+		/// <summary>
+		/// Comparison operators, which compare the packed integers without the presence bits
+		/// </summary>
+		constexpr bool operator ==(const PackedSemanticVersion& rhs) const noexcept
+		{
+			return GetKey() == rhs.GetKey();
+		}
+		constexpr bool operator !=(const PackedSemanticVersion& rhs) const noexcept
+		{
+			return GetKey() != rhs.GetKey();
+		}
+		constexpr bool operator <(const PackedSemanticVersion& rhs) const noexcept
+		{
+			return GetKey() < rhs.GetKey();
+		}
+		constexpr bool operator >(const PackedSemanticVersion& rhs) const noexcept
+		{
+			return GetKey() > rhs.GetKey();
+		}
+		constexpr bool operator <=(const PackedSemanticVersion& rhs) const noexcept
+		{
+			return GetKey() <= rhs.GetKey();
+		}
+		constexpr bool operator >=(const PackedSemanticVersion& rhs) const noexcept
+		{
+			return GetKey() >= rhs.GetKey();
+		}
+
+		/// <summary>
+		/// Convert to string
+		/// </summary>
+		std::string ToString() const
+		{
+			return ToSemanticVersion().ToString();
+		}
+
+	private:
+		constexpr uint64_t GetKey() const noexcept
+		{
+			return _value >> PresenceBits;
+		}
+
+		/// <summary>
+		/// Pack the parsed values, which fails if any value is too large to fit
+		/// </summary>
+		static bool TryPack(uint32_t major, uint32_t minor, uint32_t patch, size_t valueCount, PackedSemanticVersion& result) noexcept
+		{
+			if (major > MaxMajor || minor > MaxMinor || patch > MaxPatch)
+				return false;
+
+			result._value =
+				static_cast<uint64_t>(major) << MajorShift |
+				static_cast<uint64_t>(minor) << MinorShift |
+				static_cast<uint64_t>(patch) << PatchShift |
+				(valueCount > 1 ? HasMinorFlag : 0) |
+				(valueCount > 2 ? HasPatchFlag : 0);
+			return true;
+		}
+
+		#ifdef OPAL_PATH_SCAN_X64
+		/// <summary>
+		/// Parse a value of one to sixteen characters from a single block
+		/// The digits and dots are found with one vector compare each and the location of the dots
+		/// gives the size of every value, which are all validated together before a branch free decode.
+		/// Note: Reads a whole block, so the buffer must extend sixteen characters past the start of the value
+		/// </summary>
+		static bool TryParseBlock(const char* value, uint32_t size, PackedSemanticVersion& result) noexcept
+		{
+			auto indexes = _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+			auto sizeMask = _mm_cmpgt_epi8(_mm_set1_epi8(static_cast<char>(size)), indexes);
+			auto characters = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(value)), sizeMask);
+			auto dots = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(characters, _mm_set1_epi8('.'))));
+			auto digits = static_cast<uint32_t>(_mm_movemask_epi8(_mm_and_si128(
+				_mm_cmpgt_epi8(characters, _mm_set1_epi8('0' - 1)),
+				_mm_cmplt_epi8(characters, _mm_set1_epi8('9' + 1)))));
+
+			// Each value ends at the next dot or the end of the value
+			auto secondDots = dots & (dots - 1);
+			auto thirdDots = secondDots & (secondDots - 1);
+			auto hasMinor = dots != 0;
+			auto hasPatch = secondDots != 0;
+			auto majorEnd = hasMinor ? static_cast<uint32_t>(std::countr_zero(dots)) : size;
+			auto minorEnd = hasPatch ? static_cast<uint32_t>(std::countr_zero(secondDots)) : size;
+			auto minorSize = hasMinor ? minorEnd - majorEnd - 1 : 1;
+			auto patchSize = hasPatch ? size - minorEnd - 1 : 1;
+
+			// Every character must be a digit or one of at most two dots and every value must have digits
+			auto isValid =
+				(dots | digits) == (1u << size) - 1 &&
+				thirdDots == 0 &&
+				majorEnd - 1 < MaxDigits &&
+				minorSize - 1 < MaxDigits &&
+				patchSize - 1 < MaxDigits;
+			if (!isValid)
+				return false;
+
+			auto lower = static_cast<uint64_t>(_mm_cvtsi128_si64(characters));
+			auto upper = static_cast<uint64_t>(_mm_cvtsi128_si64(_mm_unpackhi_epi64(characters, characters)));
+			auto major = ParseDigits(lower, majorEnd);
+			auto minor = ParseDigits(ReadWord(lower, upper, majorEnd + 1), minorSize) * hasMinor;
+			auto patch = ParseDigits(ReadWord(lower, upper, minorEnd + 1), patchSize) * hasPatch;
+			return TryPack(major, minor, patch, size_t(1) + hasMinor + hasPatch, result);
+		}
+
+		/// <summary>
+		/// Read the eight characters at the offset within the sixteen character block
+		/// </summary>
+		static uint64_t ReadWord(uint64_t lower, uint64_t upper, uint32_t offset) noexcept
+		{
+			// Shift in two steps so an offset of zero does not shift the upper word by its full size
+			auto shift = 8 * (offset % sizeof(uint64_t));
+			auto combined = (lower >> shift) | ((upper << 1) << (63 - shift));
+			return offset < sizeof(uint64_t) ? combined : upper >> shift;
+		}
+
+		/// <summary>
+		/// Convert the first one to seven characters of the word from digits with a single multiply per
+		/// pair of digit groups
+		/// </summary>
+		static uint32_t ParseDigits(uint64_t digits, uint32_t size) noexcept
+		{
+			// Shift out the characters after the digits so the missing leading digits become zero
+			digits = (digits - 0x3030303030303030) << (8 * (sizeof(uint64_t) - size));
+
+			// Combine neighboring digits, then pairs into groups of four, then the two groups
+			digits = (digits * 10) + (digits >> 8);
+			digits = (((digits & 0x000000FF000000FF) * (100 + (1000000ull << 32))) +
+				(((digits >> 16) & 0x000000FF000000FF) * (1 + (10000ull << 32)))) >> 32;
+			return static_cast<uint32_t>(digits);
+		}
+		#endif
+
+	private:
+		uint64_t _value;
+	};
+}
@@ -0,0 +1,169 @@
+﻿// <copyright file="path-comparer.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+#pragma once
+#include "path.h"
+
+namespace Opal
+{
+	/// <summary>
+	/// Hash a path value using the cached hash of the path
+	/// Supports lookups with a <see cref="PathView"/> in containers keyed on <see cref="Path"/>.
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	struct PathHash
+	{
+		using is_transparent = void;
+
+		size_t operator()(const Path& value) const noexcept
+		{
+			return value.GetHash();
+		}
+
+		size_t operator()(const PathView& value) const noexcept
+		{
+			return value.GetHash();
+		}
+	};
+
+	/// <summary>
+	/// Compare two path values for exact equality
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	struct PathEqual
+	{
+		using is_transparent = void;
+
+		bool operator()(const PathView& left, const PathView& right) const noexcept
+		{
+			return left.ToStringView() == right.ToStringView();
+		}
+
+		bool operator()(const Path& left, const Path& right) const noexcept
+		{
+			return left.ToStringView() == right.ToStringView();
+		}
+
+		bool operator()(const Path& left, const PathView& right) const noexcept
+		{
+			return left.ToStringView() == right.ToStringView();
+		}
+
+		bool operator()(const PathView& left, const Path& right) const noexcept
+		{
+			return left.ToStringView() == right.ToStringView();
+		}
+	};
+
+	/// <summary>
+	/// Hash a path value ignoring the case of ASCII letters to match Windows file system semantics
+	/// Folds eight characters at a time while hashing so no lowered copy is ever created.
+	/// Note: Does not use the cached hash of the path since that is case sensitive
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	struct PathCaseInsensitiveHash
+	{
+		using is_transparent = void;
+
+		size_t operator()(const Path& value) const noexcept
+		{
+			return ComputeHash(value.ToStringView());
+		}
+
+		size_t operator()(const PathView& value) const noexcept
+		{
+			return ComputeHash(value.ToStringView());
+		}
+
+	private:
+		static size_t ComputeHash(std::string_view value) noexcept
+		{
+			return static_cast<size_t>(PathScan::HashWords(value, [](uint64_t word) { return PathScan::ToLower(word); }));
+		}
+	};
+
+	/// <summary>
+	/// Compare two path values for equality ignoring the case of ASCII letters
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	struct PathCaseInsensitiveEqual
+	{
+		using is_transparent = void;
+
+		bool operator()(const PathView& left, const PathView& right) const noexcept
+		{
+			return AreEqual(left.ToStringView(), right.ToStringView());
+		}
+
+		bool operator()(const Path& left, const Path& right) const noexcept
+		{
+			return AreEqual(left.ToStringView(), right.ToStringView());
+		}
+
+		bool operator()(const Path& left, const PathView& right) const noexcept
+		{
+			return AreEqual(left.ToStringView(), right.ToStringView());
+		}
+
+		bool operator()(const PathView& left, const Path& right) const noexcept
+		{
+			return AreEqual(left.ToStringView(), right.ToStringView());
+		}
+
+	private:
+		static bool AreEqual(std::string_view left, std::string_view right) noexcept
+		{
+			return left.size() == right.size() && PathScan::FindMismatchIgnoreCase(left, right) == left.size();
+		}
+	};
+
+	/// <summary>
+	/// Order path values ignoring the case of ASCII letters, comparing the lower case characters
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	struct PathCaseInsensitiveLess
+	{
+		using is_transparent = void;
+
+		bool operator()(const PathView& left, const PathView& right) const noexcept
+		{
+			return IsLess(left.ToStringView(), right.ToStringView());
+		}
+
+		bool operator()(const Path& left, const Path& right) const noexcept
+		{
+			return IsLess(left.ToStringView(), right.ToStringView());
+		}
+
+		bool operator()(const Path& left, const PathView& right) const noexcept
+		{
+			return IsLess(left.ToStringView(), right.ToStringView());
+		}
+
+		bool operator()(const PathView& left, const Path& right) const noexcept
+		{
+			return IsLess(left.ToStringView(), right.ToStringView());
+		}
+
+	private:
+		static bool IsLess(std::string_view left, std::string_view right) noexcept
+		{
+			auto location = PathScan::FindMismatchIgnoreCase(left, right);
+			if (location == left.size() || location == right.size())
+				return left.size() < right.size();
+
+			return static_cast<unsigned char>(PathScan::ToLower(left[location])) <
+				static_cast<unsigned char>(PathScan::ToLower(right[location]));
+		}
+	};
+}
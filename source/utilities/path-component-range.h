@@ -0,0 +1,248 @@
+﻿// <copyright file="path-component-range.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+#pragma once
+
+namespace Opal
+{
+	/// <summary>
+	/// A lazy view over the components of a path value that walks the root, directories
+	/// and file name in either direction without allocating
+	/// Note: Empty directories (double separators) are skipped
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	class PathComponentRange
+	{
+	private:
+		static constexpr char DirectorySeparator = '/';
+
+	public:
+		class Iterator
+		{
+		public:
+			using iterator_category = std::bidirectional_iterator_tag;
+			using value_type = std::string_view;
+			using difference_type = std::ptrdiff_t;
+			using pointer = const std::string_view*;
+			using reference = std::string_view;
+
+		private:
+			std::string_view _value;
+			int _rootEndLocation;
+			size_t _fileNameStartLocation;
+			size_t _start;
+			size_t _end;
+
+		public:
+			Iterator() noexcept :
+				_value(),
+				_rootEndLocation(-1),
+				_fileNameStartLocation(0),
+				_start(1),
+				_end(1)
+			{
+			}
+
+			Iterator(
+				std::string_view value,
+				int rootEndLocation,
+				size_t fileNameStartLocation,
+				size_t location) noexcept :
+				_value(value),
+				_rootEndLocation(rootEndLocation),
+				_fileNameStartLocation(fileNameStartLocation),
+				_start(value.size() + 1),
+				_end(value.size() + 1)
+			{
+				if (location == 0 && _rootEndLocation >= 0)
+				{
+					// Start on the root
+					_start = 0;
+					_end = _rootEndLocation;
+				}
+				else
+				{
+					SeekForward(location);
+				}
+			}
+
+			/// <summary>
+			/// Gets the offset of the current component within the full value
+			/// </summary>
+			size_t GetOffset() const noexcept
+			{
+				return _start;
+			}
+
+			/// <summary>
+			/// Gets a value indicating whether the current component is the root
+			/// </summary>
+			bool IsRoot() const noexcept
+			{
+				return _rootEndLocation >= 0 && _start == 0;
+			}
+
+			/// <summary>
+			/// Gets a value indicating whether the current component is the file name
+			/// </summary>
+			bool IsFileName() const noexcept
+			{
+				return _start == _fileNameStartLocation && _start < _value.size();
+			}
+
+			std::string_view operator*() const noexcept
+			{
+				return _value.substr(_start, _end - _start);
+			}
+
+			Iterator& operator++() noexcept
+			{
+				SeekForward(_end + 1);
+				return *this;
+			}
+
+			Iterator operator++(int) noexcept
+			{
+				auto result = *this;
+				++(*this);
+				return result;
+			}
+
+			Iterator& operator--() noexcept
+			{
+				SeekBackward();
+				return *this;
+			}
+
+			Iterator operator--(int) noexcept
+			{
+				auto result = *this;
+				--(*this);
+				return result;
+			}
+
+			bool operator==(const Iterator& rhs) const noexcept
+			{
+				return _start == rhs._start;
+			}
+
+			bool operator!=(const Iterator& rhs) const noexcept
+			{
+				return _start != rhs._start;
+			}
+
+		private:
+			/// <summary>
+			/// Move to the first component that starts at or after the location
+			/// </summary>
+			void SeekForward(size_t location) noexcept
+			{
+				// Skip empty directories
+				while (location < _fileNameStartLocation && _value[location] == DirectorySeparator)
+					location++;
+
+				if (location < _fileNameStartLocation)
+				{
+					// Directories always end in a separator before the file name
+					_start = location;
+					_end = _value.find(DirectorySeparator, location);
+				}
+				else if (location == _fileNameStartLocation && _fileNameStartLocation < _value.size())
+				{
+					_start = _fileNameStartLocation;
+					_end = _value.size();
+				}
+				else
+				{
+					_start = _value.size() + 1;
+					_end = _start;
+				}
+			}
+
+			/// <summary>
+			/// Move to the component that ends before the current component
+			/// </summary>
+			void SeekBackward() noexcept
+			{
+				// Find the separator that ends the previous component
+				size_t end;
+				if (_start > _value.size())
+				{
+					if (_fileNameStartLocation < _value.size())
+					{
+						_start = _fileNameStartLocation;
+						_end = _value.size();
+						return;
+					}
+
+					end = _value.size() - 1;
+				}
+				else
+				{
+					end = _start - 1;
+				}
+
+				while (true)
+				{
+					if (_rootEndLocation >= 0 && end == static_cast<size_t>(_rootEndLocation))
+					{
+						_start = 0;
+						_end = end;
+						return;
+					}
+
+					auto start = end;
+					while (start > 0 && _value[start - 1] != DirectorySeparator)
+						start--;
+
+					// Skip empty directories
+					if (start == end && end > 0)
+					{
+						end--;
+						continue;
+					}
+
+					_start = start;
+					_end = end;
+					return;
+				}
+			}
+		};
+
+	private:
+		std::string_view _value;
+		int _rootEndLocation;
+		size_t _fileNameStartLocation;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref="PathComponentRange"/> class.
+		/// </summary>
+		PathComponentRange(
+			std::string_view value,
+			int rootEndLocation,
+			size_t fileNameStartLocation) noexcept :
+			_value(value),
+			_rootEndLocation(rootEndLocation),
+			_fileNameStartLocation(fileNameStartLocation)
+		{
+		}
+
+		Iterator begin() const noexcept
+		{
+			return Iterator(_value, _rootEndLocation, _fileNameStartLocation, 0);
+		}
+
+		Iterator end() const noexcept
+		{
+			return Iterator(_value, _rootEndLocation, _fileNameStartLocation, _value.size() + 1);
+		}
+
+		bool empty() const noexcept
+		{
+			return begin() == end();
+		}
+	};
+}
@@ -0,0 +1,337 @@
+﻿// <copyright file="path-list-parser.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+#pragma once
+#include "path.h"
+
+namespace Opal
+{
+	/// <summary>
+	/// Splits the large lists of paths written by other tools into paths in a single pass
+	/// LINES: One path per line, such as a response file. Surrounding whitespace and quotes are removed
+	/// and empty lines are skipped.
+	/// DEPENDENCIES: A make style dependency file, such as the output of -MD. The targets before each
+	/// colon are skipped and every prerequisite is returned. Words are separated by spaces or tabs and an
+	/// unescaped comment character hides the rest of the line. Line continuations, spaces and comment
+	/// characters escaped with a backslash and escaped dollar signs are resolved.
+	/// The delimiters are found with the vectorized <see cref="PathScan"/> and every path is normalized
+	/// with <see cref="Path::Parse"/>, which also converts the alternate directory separators.
+	/// The parsed paths are appended to the existing list so multiple files can be combined, or written
+	/// contiguously into a single buffer with views over them to avoid the large list of owning paths.
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	class PathListParser
+	{
+	private:
+		static constexpr char LineSeparator = '\n';
+		static constexpr char Space = ' ';
+		static constexpr char Tab = '\t';
+		static constexpr char Escape = '\\';
+		static constexpr char Dollar = '$';
+		static constexpr char Comment = '#';
+		static constexpr char TargetSeparator = ':';
+
+	public:
+		/// <summary>
+		/// Parse a list with one path per line
+		/// </summary>
+		static void ParseLines(std::string_view content, std::vector<Path>& paths)
+		{
+			ForEachLine(content, [&](std::string_view line)
+			{
+				paths.push_back(Path::Parse(line));
+			});
+		}
+
+		/// <summary>
+		/// Parse a list with one path per line, writing the values contiguously into the buffer
+		/// The buffer and views are replaced, which allows reusing their capacity across calls.
+		/// Note: The views reference the buffer and are only valid until it is next modified
+		/// </summary>
+		static void ParseLines(std::string_view content, std::string& buffer, std::vector<PathView>& views)
+		{
+			auto writer = ViewWriter(content, buffer, views);
+			ForEachLine(content, [&](std::string_view line)
+			{
+				writer.Append(Path::Parse(line));
+			});
+
+			writer.Finish();
+		}
+
+		/// <summary>
+		/// Parse the prerequisites from a make style dependency file
+		/// </summary>
+		static void ParseDependencies(std::string_view content, std::vector<Path>& paths)
+		{
+			ForEachDependency(content, [&](std::string_view dependency)
+			{
+				paths.push_back(Path::Parse(dependency));
+			});
+		}
+
+		/// <summary>
+		/// Parse the prerequisites from a make style dependency file, writing the values contiguously into the buffer
+		/// The buffer and views are replaced, which allows reusing their capacity across calls.
+		/// Note: The views reference the buffer and are only valid until it is next modified
+		/// </summary>
+		static void ParseDependencies(std::string_view content, std::string& buffer, std::vector<PathView>& views)
+		{
+			auto writer = ViewWriter(content, buffer, views);
+			ForEachDependency(content, [&](std::string_view dependency)
+			{
+				writer.Append(Path::Parse(dependency));
+			});
+
+			writer.Finish();
+		}
+
+	private:
+		/// <summary>
+		/// Copies the parsed paths into a single buffer and keeps views over them
+		/// </summary>
+		class ViewWriter
+		{
+		private:
+			std::string& _buffer;
+			std::vector<PathView>& _views;
+			size_t _location;
+
+		public:
+			ViewWriter(std::string_view content, std::string& buffer, std::vector<PathView>& views) :
+				_buffer(buffer),
+				_views(views),
+				_location(0)
+			{
+				// Size the buffer once for the common case where the normalized paths are no longer than the content
+				// Note: A single path can add a relative directory prefix, which is covered by the extra space
+				_buffer.resize(content.size() + 2);
+				_views.clear();
+			}
+
+			void Append(const Path& path)
+			{
+				auto value = path.ToView();
+				auto size = value._value.size();
+				if (_location + size > _buffer.size())
+					Grow(_location + size);
+
+				std::memcpy(_buffer.data() + _location, value._value.data(), size);
+				_views.push_back(PathView(
+					std::string_view(_buffer.data() + _location, size),
+					value._rootEndLocation,
+					value._fileNameStartLocation));
+				_location += size;
+			}
+
+			void Finish()
+			{
+				_buffer.resize(_location);
+			}
+
+		private:
+			/// <summary>
+			/// Grow the buffer for a list of short paths that each gained a prefix and move the views over
+			/// </summary>
+			void Grow(size_t size)
+			{
+				auto previous = _buffer.data();
+				_buffer.resize(std::max(size, 2 * _buffer.size()));
+				for (auto& view : _views)
+				{
+					auto offset = static_cast<size_t>(view._value.data() - previous);
+					view._value = std::string_view(_buffer.data() + offset, view._value.size());
+				}
+			}
+		};
+
+		/// <summary>
+		/// Invoke the callback with every non empty line, without the surrounding whitespace and quotes
+		/// </summary>
+		template<typename TCallback>
+		static void ForEachLine(std::string_view content, TCallback&& callback)
+		{
+			size_t lineStart = 0;
+			auto addLine = [&](size_t lineEnd)
+			{
+				auto line = Trim(content.substr(lineStart, lineEnd - lineStart));
+				if (line.size() >= 2 && line.front() == '"' && line.back() == '"')
+					line = line.substr(1, line.size() - 2);
+
+				if (!line.empty())
+					callback(line);
+
+				lineStart = lineEnd + 1;
+			};
+
+			PathScan::ForEachMatch(content, LineSeparator, LineSeparator, addLine);
+			if (lineStart < content.size())
+				addLine(content.size());
+		}
+
+		/// <summary>
+		/// Invoke the callback with every unescaped prerequisite in a make style dependency file
+		/// </summary>
+		template<typename TCallback>
+		static void ForEachDependency(std::string_view content, TCallback&& callback)
+		{
+			// Every rule starts with its targets, which end at the first word with a trailing colon
+			bool isTarget = true;
+			bool isComment = false;
+			bool hasEscapedSpace = false;
+			size_t wordStart = 0;
+			auto unescaped = std::string();
+			auto addWord = [&](std::string_view word)
+			{
+				if (isComment)
+					return;
+
+				word = Trim(word);
+				auto special = PathScan::FindFirst(word, 0, Dollar, Comment);
+				if (special != std::string_view::npos)
+				{
+					// A comment runs to the end of the line, only keep the word in front of it
+					auto commentStart = FindComment(word, special);
+					if (commentStart != std::string_view::npos)
+					{
+						word = Trim(word.substr(0, commentStart));
+						isComment = true;
+					}
+				}
+
+				if (word.empty())
+				{
+					// Nothing to add
+				}
+				else if (isTarget)
+				{
+					if (word.back() == TargetSeparator)
+						isTarget = false;
+				}
+				else if (hasEscapedSpace || special < word.size())
+				{
+					Unescape(word, unescaped);
+					callback(std::string_view(unescaped));
+				}
+				else
+				{
+					callback(word);
+				}
+			};
+
+			// Tabs separate words the same as spaces, but are rare enough to split off the hot path
+			auto addWords = [&](size_t wordEnd)
+			{
+				auto words = content.substr(wordStart, wordEnd - wordStart);
+				for (auto tab = words.find(Tab); tab != std::string_view::npos; tab = words.find(Tab))
+				{
+					addWord(words.substr(0, tab));
+					words = words.substr(tab + 1);
+				}
+
+				addWord(words);
+				hasEscapedSpace = false;
+			};
+
+			PathScan::ForEachMatch(content, Space, LineSeparator, [&](size_t location)
+			{
+				bool isEscaped = location > 0 && content[location - 1] == Escape;
+				if (content[location] == Space)
+				{
+					// An escaped space is part of the current word
+					if (isEscaped)
+					{
+						hasEscapedSpace = true;
+						return;
+					}
+
+					addWords(location);
+				}
+				else
+				{
+					// A line continuation only ends the current word, otherwise the line ends the rule and any comment
+					if (!isEscaped && location > 1 && content[location - 1] == '\r' && content[location - 2] == Escape)
+						isEscaped = true;
+
+					if (isEscaped)
+					{
+						addWords(content.rfind(Escape, location));
+					}
+					else
+					{
+						addWords(location);
+						isTarget = true;
+						isComment = false;
+					}
+				}
+
+				wordStart = location + 1;
+			});
+
+			if (wordStart < content.size())
+				addWords(content.size());
+		}
+
+		/// <summary>
+		/// Find the first comment character that is not escaped with a backslash, starting at the location
+		/// </summary>
+		static size_t FindComment(std::string_view value, size_t location) noexcept
+		{
+			for (location = value.find(Comment, location); location != std::string_view::npos; location = value.find(Comment, location + 1))
+			{
+				if (location == 0 || value[location - 1] != Escape)
+					return location;
+			}
+
+			return std::string_view::npos;
+		}
+
+		/// <summary>
+		/// Remove the surrounding whitespace, including the carriage return of a Windows line ending
+		/// </summary>
+		static std::string_view Trim(std::string_view value) noexcept
+		{
+			auto isWhitespace = [](char value)
+			{
+				return value == ' ' || value == '\t' || value == '\r';
+			};
+
+			size_t start = 0;
+			while (start < value.size() && isWhitespace(value[start]))
+				start++;
+
+			size_t end = value.size();
+			while (end > start && isWhitespace(value[end - 1]))
+				end--;
+
+			return value.substr(start, end - start);
+		}
+
+		/// <summary>
+		/// Resolve the escaped spaces, comment characters and dollar signs in a dependency file word
+		/// Note: Any other backslash is a directory separator and is left for parsing
+		/// </summary>
+		static void Unescape(std::string_view value, std::string& result)
+		{
+			result.clear();
+			for (size_t location = 0; location < value.size(); location++)
+			{
+				auto current = value[location];
+				if (location + 1 < value.size())
+				{
+					auto next = value[location + 1];
+					if ((current == Escape && (next == Space || next == Comment)) ||
+						(current == Dollar && next == Dollar))
+					{
+						location++;
+						current = next;
+					}
+				}
+
+				result.push_back(current);
+			}
+		}
+	};
+}
@@ -0,0 +1,294 @@
+﻿// <copyright file="path-list.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+#pragma once
+#include "path.h"
+
+namespace Opal
+{
+	/// <summary>
+	/// The binary layout shared by the path list writer and reader
+	/// HEADER: magic, version, path count, total size of every path value (fixed width little endian)
+	/// ENTRY: shared prefix size, suffix size, suffix characters, root end location + 1, file name start location
+	/// The sizes and locations in an entry are variable length integers, seven bits per byte.
+	/// Each entry shares its prefix with the previous path, so a sorted list only stores the
+	/// characters that differ between neighbors.
+	/// </summary>
+	class PathListFormat
+	{
+	public:
+		static constexpr uint32_t Magic = 0x4C50504F; // 'OPPL'
+		static constexpr uint32_t Version = 1;
+		static constexpr size_t HeaderSize = 2 * sizeof(uint32_t) + 2 * sizeof(uint64_t);
+
+		template<typename T>
+		static void WriteFixed(char* buffer, T value) noexcept
+		{
+			for (auto i = 0u; i < sizeof(T); i++)
+				buffer[i] = static_cast<char>(static_cast<uint8_t>(value >> (8 * i)));
+		}
+
+		template<typename T>
+		static T ReadFixed(const char* buffer) noexcept
+		{
+			T result = 0;
+			for (auto i = 0u; i < sizeof(T); i++)
+				result |= static_cast<T>(static_cast<uint8_t>(buffer[i])) << (8 * i);
+			return result;
+		}
+
+		static void WriteVariable(std::string& buffer, uint64_t value)
+		{
+			while (value >= 0x80)
+			{
+				buffer.push_back(static_cast<char>(static_cast<uint8_t>(value) | 0x80));
+				value >>= 7;
+			}
+
+			buffer.push_back(static_cast<char>(value));
+		}
+	};
+
+	/// <summary>
+	/// Writes a list of paths into the compact binary path list format
+	/// The list is front coded against the previous path, so writing the paths in sorted order
+	/// gives the best compression. The root and file name locations are stored with every path so
+	/// reading never has to validate or scan the values again.
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	class PathListWriter
+	{
+	private:
+		std::string _buffer;
+		std::string _previous;
+		uint64_t _count;
+		uint64_t _totalSize;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref="PathListWriter"/> class.
+		/// </summary>
+		PathListWriter() :
+			_buffer(PathListFormat::HeaderSize, '\0'),
+			_previous(),
+			_count(0),
+			_totalSize(0)
+		{
+		}
+
+		/// <summary>
+		/// Gets the number of paths written
+		/// </summary>
+		size_t GetCount() const noexcept
+		{
+			return static_cast<size_t>(_count);
+		}
+
+		/// <summary>
+		/// Append a path to the list
+		/// </summary>
+		void Write(const PathView& path)
+		{
+			auto value = path.ToStringView();
+			auto sharedSize = PathScan::FindMismatch(_previous, value);
+			auto suffix = value.substr(sharedSize);
+
+			PathListFormat::WriteVariable(_buffer, sharedSize);
+			PathListFormat::WriteVariable(_buffer, suffix.size());
+			_buffer.append(suffix);
+			PathListFormat::WriteVariable(_buffer, static_cast<uint64_t>(path._rootEndLocation + 1));
+			PathListFormat::WriteVariable(_buffer, path._fileNameStartLocation);
+
+			// Only the changed suffix has to be copied to track the previous value
+			_previous.resize(sharedSize);
+			_previous.append(suffix);
+
+			_count++;
+			_totalSize += value.size();
+		}
+
+		void Write(const Path& path)
+		{
+			Write(path.ToView());
+		}
+
+		/// <summary>
+		/// Get the completed list data
+		/// Note: The data is only valid until the next path is written
+		/// </summary>
+		std::string_view GetData()
+		{
+			PathListFormat::WriteFixed(_buffer.data(), PathListFormat::Magic);
+			PathListFormat::WriteFixed(_buffer.data() + 4, PathListFormat::Version);
+			PathListFormat::WriteFixed(_buffer.data() + 8, _count);
+			PathListFormat::WriteFixed(_buffer.data() + 16, _totalSize);
+			return _buffer;
+		}
+
+		/// <summary>
+		/// Write the completed list to the stream
+		/// </summary>
+		void WriteTo(std::ostream& stream)
+		{
+			auto data = GetData();
+			stream.write(data.data(), data.size());
+		}
+	};
+
+	/// <summary>
+	/// Reads a list of paths from the compact binary path list format
+	/// The reader works directly over the provided bytes, which allows loading from a memory mapped file
+	/// without an extra copy. All of the path values are restored into a single buffer sized up front
+	/// from the header and the stored locations are used as is, so no value is scanned or validated again.
+	/// Note: Corrupt data is detected through bounds checks on every entry and reported as an exception
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	class PathListReader
+	{
+	private:
+		std::string_view _data;
+		size_t _count;
+		size_t _totalSize;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref="PathListReader"/> class.
+		/// Note: The data must outlive the reader
+		/// </summary>
+		PathListReader(std::string_view data) :
+			_data(data),
+			_count(0),
+			_totalSize(0)
+		{
+			if (_data.size() < PathListFormat::HeaderSize ||
+				PathListFormat::ReadFixed<uint32_t>(_data.data()) != PathListFormat::Magic)
+			{
+				throw std::runtime_error("Path list has an invalid header");
+			}
+
+			auto version = PathListFormat::ReadFixed<uint32_t>(_data.data() + 4);
+			if (version != PathListFormat::Version)
+				throw std::runtime_error(std::format("Unknown path list version {}", version));
+
+			_count = static_cast<size_t>(PathListFormat::ReadFixed<uint64_t>(_data.data() + 8));
+			_totalSize = static_cast<size_t>(PathListFormat::ReadFixed<uint64_t>(_data.data() + 16));
+
+			// Every entry is at least four bytes and no path can be longer than all of the stored characters,
+			// which bounds the count and size before anything is allocated for them
+			auto entriesSize = _data.size() - PathListFormat::HeaderSize;
+			if (_count > entriesSize / 4 || _totalSize > _count * entriesSize)
+				throw std::runtime_error("Path list header does not match the data");
+		}
+
+		/// <summary>
+		/// Gets the number of paths in the list
+		/// </summary>
+		size_t GetCount() const noexcept
+		{
+			return _count;
+		}
+
+		/// <summary>
+		/// Read all of the paths, writing the values contiguously into the buffer
+		/// The buffer and views are replaced, which allows reusing their capacity across calls.
+		/// Note: The views reference the buffer and are only valid until it is next modified
+		/// </summary>
+		void ReadAll(std::string& buffer, std::vector<PathView>& views) const
+		{
+			buffer.resize(_totalSize);
+			views.clear();
+			views.reserve(_count);
+
+			// Every path starts as a copy of the shared prefix from the previous path in the buffer
+			size_t location = 0;
+			size_t previousStart = 0;
+			ForEachEntry([&](size_t sharedSize, std::string_view suffix, int rootEndLocation, size_t fileNameStartLocation)
+			{
+				auto size = sharedSize + suffix.size();
+				if (location + size > buffer.size())
+					throw std::runtime_error("Path list is larger than the header size");
+
+				std::memcpy(buffer.data() + location, buffer.data() + previousStart, sharedSize);
+				std::memcpy(buffer.data() + location + sharedSize, suffix.data(), suffix.size());
+				views.push_back(PathView(
+					std::string_view(buffer.data() + location, size),
+					rootEndLocation,
+					fileNameStartLocation));
+
+				previousStart = location;
+				location += size;
+			});
+
+			buffer.resize(location);
+		}
+
+		/// <summary>
+		/// Read all of the paths into owning paths
+		/// </summary>
+		void ReadAll(std::vector<Path>& paths) const
+		{
+			paths.clear();
+			paths.reserve(_count);
+
+			// Restore each value over the previous one in place
+			auto value = std::string();
+			ForEachEntry([&](size_t sharedSize, std::string_view suffix, int rootEndLocation, size_t fileNameStartLocation)
+			{
+				value.resize(sharedSize);
+				value.append(suffix);
+				paths.push_back(Path(PathView(value, rootEndLocation, fileNameStartLocation)));
+			});
+		}
+
+	private:
+		/// <summary>
+		/// Decode every entry in order and verify that the values it references are in bounds
+		/// </summary>
+		template<typename TCallback>
+		void ForEachEntry(TCallback&& callback) const
+		{
+			size_t location = PathListFormat::HeaderSize;
+			size_t previousSize = 0;
+			for (size_t i = 0; i < _count; i++)
+			{
+				auto sharedSize = ReadVariable(location);
+				auto suffixSize = ReadVariable(location);
+				if (sharedSize > previousSize || suffixSize > _data.size() - location)
+					throw std::runtime_error("Path list entry is out of bounds");
+
+				auto suffix = _data.substr(location, suffixSize);
+				location += suffixSize;
+
+				auto rootEnd = ReadVariable(location);
+				auto fileNameStartLocation = ReadVariable(location);
+				auto size = sharedSize + suffixSize;
+				if (rootEnd > size || fileNameStartLocation > size)
+					throw std::runtime_error("Path list entry is out of bounds");
+
+				callback(sharedSize, suffix, static_cast<int>(rootEnd) - 1, fileNameStartLocation);
+				previousSize = size;
+			}
+		}
+
+		size_t ReadVariable(size_t& location) const
+		{
+			uint64_t result = 0;
+			for (uint32_t shift = 0; shift < 64; shift += 7)
+			{
+				if (location >= _data.size())
+					throw std::runtime_error("Path list ended unexpectedly");
+
+				auto current = static_cast<uint8_t>(_data[location++]);
+				result |= static_cast<uint64_t>(current & 0x7F) << shift;
+				if ((current & 0x80) == 0)
+					return static_cast<size_t>(result);
+			}
+
+			throw std::runtime_error("Path list has an invalid size");
+		}
+	};
+}
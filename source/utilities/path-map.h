@@ -0,0 +1,348 @@
+﻿// <copyright file="path-map.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+#pragma once
+#include "hash-index.h"
+#include "path-comparer.h"
+
+namespace Opal
+{
+	/// <summary>
+	/// A hash map with path keys that stores the entries in a dense list
+	/// Lookups compare the path hash before comparing the strings. The hash and equality policies
+	/// select how keys match, such as <see cref="PathCaseInsensitiveHash"/> with
+	/// <see cref="PathCaseInsensitiveEqual"/> for Windows semantics.
+	/// Note: Erasing an entry moves the last entry into its place.
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	template<typename TValue, typename THash = PathHash, typename TEqual = PathEqual>
+	class PathMap
+	{
+	private:
+		using raw_data = std::vector<std::pair<Path, TValue>>;
+		raw_data _data;
+		HashIndex _index;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref="PathMap"/> class.
+		/// </summary>
+		PathMap() :
+			_data(),
+			_index()
+		{
+		}
+
+		PathMap(std::initializer_list<std::pair<Path, TValue>> init) :
+			_data(),
+			_index()
+		{
+			Reserve(init.size());
+			for (auto& entry : init)
+				Insert(entry.first, entry.second);
+		}
+
+		/// <summary>
+		/// Gets the number of entries
+		/// </summary>
+		size_t GetCount() const noexcept
+		{
+			return _data.size();
+		}
+
+		/// <summary>
+		/// Ensure there is room for the requested number of entries without rehashing
+		/// </summary>
+		void Reserve(size_t count)
+		{
+			_data.reserve(count);
+			if (_index.NeedsGrowth(count))
+				_index.Rebuild(count);
+		}
+
+		void Clear() noexcept
+		{
+			_data.clear();
+			_index.Clear();
+		}
+
+		bool Contains(const Path& key) const
+		{
+			return FindPosition(key) != HashIndex::NotFound;
+		}
+
+		bool Contains(PathView key) const
+		{
+			return FindPosition(key) != HashIndex::NotFound;
+		}
+
+		void Insert(const Path& key, TValue value)
+		{
+			auto [wasInserted, valueReference] = TryInsert(key, std::move(value));
+			if (!wasInserted)
+			{
+				throw std::runtime_error("Key already exists");
+			}
+		}
+
+		std::pair<bool, TValue*> TryInsert(Path key, TValue value)
+		{
+			// Hash the key once for both the lookup and the new entry
+			auto hash = THash()(key);
+			if (FindSlot(key.ToView(), hash) != HashIndex::NotFound)
+			{
+				return std::make_pair<bool, TValue*>(false, nullptr);
+			}
+			else
+			{
+				if (_index.NeedsGrowth(_data.size() + 1))
+					_index.Rebuild(_data.size() * 2);
+
+				auto& entry = _data.emplace_back(std::move(key), std::move(value));
+				_index.Insert(hash, _data.size() - 1);
+				return std::make_pair<bool, TValue*>(true, &entry.second);
+			}
+		}
+
+		bool TryGet(const Path& key, TValue*& value)
+		{
+			return TryGetValue(FindPosition(key), value);
+		}
+
+		bool TryGet(const Path& key, const TValue*& value) const
+		{
+			return TryGetValue(FindPosition(key), value);
+		}
+
+		bool TryGet(PathView key, TValue*& value)
+		{
+			return TryGetValue(FindPosition(key), value);
+		}
+
+		bool TryGet(PathView key, const TValue*& value) const
+		{
+			return TryGetValue(FindPosition(key), value);
+		}
+
+		/// <summary>
+		/// Remove the entry for the key if present
+		/// </summary>
+		bool Erase(const Path& key)
+		{
+			auto slot = FindSlot(key.ToView(), THash()(key));
+			if (slot == HashIndex::NotFound)
+				return false;
+
+			// Fill the hole with the last entry to keep the data dense
+			auto position = _index.GetPosition(slot);
+			_index.Erase(slot);
+			auto last = _data.size() - 1;
+			if (position != last)
+			{
+				_data[position] = std::move(_data[last]);
+				_index.Move(THash()(_data[position].first), last, position);
+			}
+
+			_data.pop_back();
+			return true;
+		}
+
+		raw_data::const_iterator begin() const
+		{
+			return _data.begin();
+		}
+
+		raw_data::const_iterator end() const
+		{
+			return _data.end();
+		}
+
+		const TValue& operator[](const Path& key) const
+		{
+			const TValue* value;
+			if (TryGet(key, value))
+			{
+				return *value;
+			}
+			else
+			{
+				throw std::runtime_error("Missing key");
+			}
+		}
+
+	private:
+		size_t FindSlot(PathView key, size_t hash) const
+		{
+			return _index.FindSlot(
+				hash,
+				[&](size_t position) { return TEqual()(_data[position].first, key); });
+		}
+
+		size_t FindPosition(const Path& key) const
+		{
+			auto slot = FindSlot(key.ToView(), THash()(key));
+			return slot != HashIndex::NotFound ? _index.GetPosition(slot) : HashIndex::NotFound;
+		}
+
+		size_t FindPosition(PathView key) const
+		{
+			auto slot = FindSlot(key, THash()(key));
+			return slot != HashIndex::NotFound ? _index.GetPosition(slot) : HashIndex::NotFound;
+		}
+
+		bool TryGetValue(size_t position, TValue*& value)
+		{
+			if (position == HashIndex::NotFound)
+			{
+				value = nullptr;
+				return false;
+			}
+
+			value = &_data[position].second;
+			return true;
+		}
+
+		bool TryGetValue(size_t position, const TValue*& value) const
+		{
+			if (position == HashIndex::NotFound)
+			{
+				value = nullptr;
+				return false;
+			}
+
+			value = &_data[position].second;
+			return true;
+		}
+	};
+
+	/// <summary>
+	/// A hash set of paths that stores the values in a dense list
+	/// Lookups compare the path hash before comparing the strings, using the same policies as <see cref="PathMap"/>.
+	/// Note: Erasing a value moves the last value into its place.
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	template<typename THash = PathHash, typename TEqual = PathEqual>
+	class PathSet
+	{
+	private:
+		using raw_data = std::vector<Path>;
+		raw_data _data;
+		HashIndex _index;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref="PathSet"/> class.
+		/// </summary>
+		PathSet() :
+			_data(),
+			_index()
+		{
+		}
+
+		PathSet(std::initializer_list<Path> init) :
+			_data(),
+			_index()
+		{
+			Reserve(init.size());
+			for (auto& value : init)
+				Insert(value);
+		}
+
+		/// <summary>
+		/// Gets the number of values
+		/// </summary>
+		size_t GetCount() const noexcept
+		{
+			return _data.size();
+		}
+
+		/// <summary>
+		/// Ensure there is room for the requested number of values without rehashing
+		/// </summary>
+		void Reserve(size_t count)
+		{
+			_data.reserve(count);
+			if (_index.NeedsGrowth(count))
+				_index.Rebuild(count);
+		}
+
+		void Clear() noexcept
+		{
+			_data.clear();
+			_index.Clear();
+		}
+
+		bool Contains(const Path& value) const
+		{
+			return FindSlot(value.ToView(), THash()(value)) != HashIndex::NotFound;
+		}
+
+		bool Contains(PathView value) const
+		{
+			return FindSlot(value, THash()(value)) != HashIndex::NotFound;
+		}
+
+		/// <summary>
+		/// Add the value if it is not already present
+		/// </summary>
+		bool Insert(Path value)
+		{
+			// Hash the value once for both the lookup and the new entry
+			auto hash = THash()(value);
+			if (FindSlot(value.ToView(), hash) != HashIndex::NotFound)
+				return false;
+
+			if (_index.NeedsGrowth(_data.size() + 1))
+				_index.Rebuild(_data.size() * 2);
+
+			_data.push_back(std::move(value));
+			_index.Insert(hash, _data.size() - 1);
+			return true;
+		}
+
+		/// <summary>
+		/// Remove the value if present
+		/// </summary>
+		bool Erase(const Path& value)
+		{
+			auto slot = FindSlot(value.ToView(), THash()(value));
+			if (slot == HashIndex::NotFound)
+				return false;
+
+			// Fill the hole with the last value to keep the data dense
+			auto position = _index.GetPosition(slot);
+			_index.Erase(slot);
+			auto last = _data.size() - 1;
+			if (position != last)
+			{
+				_data[position] = std::move(_data[last]);
+				_index.Move(THash()(_data[position]), last, position);
+			}
+
+			_data.pop_back();
+			return true;
+		}
+
+		raw_data::const_iterator begin() const
+		{
+			return _data.begin();
+		}
+
+		raw_data::const_iterator end() const
+		{
+			return _data.end();
+		}
+
+	private:
+		size_t FindSlot(PathView value, size_t hash) const
+		{
+			return _index.FindSlot(
+				hash,
+				[&](size_t position) { return TEqual()(_data[position], value); });
+		}
+	};
+}
@@ -0,0 +1,173 @@
+﻿// <copyright file="path-pool.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+#pragma once
+#include "path.h"
+
+namespace Opal
+{
+	/// <summary>
+	/// A handle to a unique path value stored in a <see cref="PathPool"/>
+	/// Equality, hashing and ordering only look at the handle value.
+	/// Note: Ordering is by insertion into the pool, not the path string.
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	class InternedPath
+	{
+	private:
+		uint32_t _handle;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref="InternedPath"/> class
+		/// that refers to the empty path that is present in every pool.
+		/// </summary>
+		InternedPath() noexcept :
+			_handle(0)
+		{
+		}
+
+		explicit InternedPath(uint32_t handle) noexcept :
+			_handle(handle)
+		{
+		}
+
+		/// <summary>
+		/// Gets the raw handle value
+		/// </summary>
+		uint32_t GetHandle() const noexcept
+		{
+			return _handle;
+		}
+
+		bool operator ==(const InternedPath& rhs) const noexcept
+		{
+			return _handle == rhs._handle;
+		}
+
+		bool operator !=(const InternedPath& rhs) const noexcept
+		{
+			return _handle != rhs._handle;
+		}
+
+		bool operator <(const InternedPath& rhs) const noexcept
+		{
+			return _handle < rhs._handle;
+		}
+	};
+
+	/// <summary>
+	/// A thread safe store of unique paths that hands out a small handle for each value
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	class PathPool
+	{
+	private:
+		// Note: A deque never moves existing elements so the lookup can reference the stored values
+		mutable std::shared_mutex _mutex;
+		std::deque<Path> _paths;
+		std::unordered_map<std::string_view, uint32_t> _lookup;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref="PathPool"/> class.
+		/// </summary>
+		PathPool() :
+			_mutex(),
+			_paths(),
+			_lookup()
+		{
+			// Reserve the first handle for the empty path
+			Intern(Path());
+		}
+
+		PathPool(const PathPool&) = delete;
+		PathPool& operator=(const PathPool&) = delete;
+
+		/// <summary>
+		/// Get the handle for the provided path, adding it to the pool if it is new
+		/// </summary>
+		InternedPath Intern(const Path& value)
+		{
+			auto key = value.ToStringView();
+
+			// Check for an existing entry with only a shared lock
+			{
+				auto lock = std::shared_lock<std::shared_mutex>(_mutex);
+				auto existing = _lookup.find(key);
+				if (existing != _lookup.end())
+					return InternedPath(existing->second);
+			}
+
+			auto lock = std::unique_lock<std::shared_mutex>(_mutex);
+
+			// Check again in case another thread inserted while waiting on the lock
+			auto existing = _lookup.find(key);
+			if (existing != _lookup.end())
+				return InternedPath(existing->second);
+
+			if (_paths.size() >= std::numeric_limits<uint32_t>::max())
+				throw std::runtime_error("Path pool handle overflow");
+
+			auto handle = static_cast<uint32_t>(_paths.size());
+			auto& stored = _paths.emplace_back(value);
+			_lookup.emplace(stored.ToStringView(), handle);
+
+			return InternedPath(handle);
+		}
+
+		/// <summary>
+		/// Try to find the handle for a path without adding it to the pool
+		/// </summary>
+		bool TryFind(const Path& value, InternedPath& result) const
+		{
+			auto lock = std::shared_lock<std::shared_mutex>(_mutex);
+			auto existing = _lookup.find(value.ToStringView());
+			if (existing != _lookup.end())
+			{
+				result = InternedPath(existing->second);
+				return true;
+			}
+			else
+			{
+				result = InternedPath();
+				return false;
+			}
+		}
+
+		/// <summary>
+		/// Get the stored path for a handle
+		/// Note: The reference remains valid for the lifetime of the pool
+		/// </summary>
+		const Path& GetPath(InternedPath value) const
+		{
+			auto lock = std::shared_lock<std::shared_mutex>(_mutex);
+			if (value.GetHandle() >= _paths.size())
+				throw std::runtime_error("Unknown interned path handle");
+
+			return _paths[value.GetHandle()];
+		}
+
+		/// <summary>
+		/// Gets the number of unique paths stored in the pool
+		/// </summary>
+		size_t GetCount() const
+		{
+			auto lock = std::shared_lock<std::shared_mutex>(_mutex);
+			return _paths.size();
+		}
+	};
+}
+
+template<>
+struct std::hash<Opal::InternedPath>
+{
+	size_t operator()(const Opal::InternedPath& value) const noexcept
+	{
+		return std::hash<uint32_t>()(value.GetHandle());
+	}
+};
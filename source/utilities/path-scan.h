@@ -0,0 +1,510 @@
+﻿// <copyright file="path-scan.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+#pragma once
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define OPAL_PATH_SCAN_X64
+#if defined(_MSC_VER) && !defined(__clang__)
+#define OPAL_PATH_SCAN_TARGET_AVX2
+#else
+#define OPAL_PATH_SCAN_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+namespace Opal
+{
+	/// <summary>
+	/// Vectorized character scanning used to parse and convert path strings
+	/// Each block of characters is converted into a bitmask of the matching locations so all
+	/// separators in a block are found in one pass. Uses AVX2 or SSE2 when available, selected
+	/// once at runtime, with a portable scalar fallback.
+	/// </summary>
+	class PathScan
+	{
+	public:
+		enum class InstructionSet
+		{
+			Scalar,
+			SSE2,
+			AVX2,
+		};
+
+		/// <summary>
+		/// The number of characters checked for each mask
+		/// </summary>
+		static constexpr size_t BlockSize = 64;
+
+		/// <summary>
+		/// The set of kernels for a single instruction set
+		/// MatchMask requires a full block of readable characters.
+		/// Replace supports the source and destination being the same buffer.
+		/// </summary>
+		struct Kernels
+		{
+			uint64_t (*MatchMask)(const char* block, char first, char second) noexcept;
+			void (*Replace)(const char* source, size_t size, char* destination, char from, char to) noexcept;
+		};
+
+	public:
+		/// <summary>
+		/// Gets the best instruction set supported by the current processor
+		/// </summary>
+		static InstructionSet GetInstructionSet() noexcept
+		{
+			static const InstructionSet value = DetectInstructionSet();
+			return value;
+		}
+
+		/// <summary>
+		/// Gets the kernels for the requested instruction set, falling back to scalar when not compiled in
+		/// </summary>
+		static Kernels GetKernels(InstructionSet instructionSet) noexcept
+		{
+			#ifdef OPAL_PATH_SCAN_X64
+			switch (instructionSet)
+			{
+				case InstructionSet::AVX2:
+					return { &MatchMaskAVX2, &ReplaceAVX2 };
+				case InstructionSet::SSE2:
+					return { &MatchMaskSSE2, &ReplaceSSE2 };
+				default:
+					break;
+			}
+			#endif
+
+			return { &MatchMaskScalar, &ReplaceScalar };
+		}
+
+		/// <summary>
+		/// Find the first location at or after the offset that matches either character
+		/// </summary>
+		static size_t FindFirst(std::string_view value, size_t offset, char first, char second) noexcept
+		{
+			return FindFirst(GetActiveKernels(), value, offset, first, second);
+		}
+
+		static size_t FindFirst(
+			const Kernels& kernels,
+			std::string_view value,
+			size_t offset,
+			char first,
+			char second) noexcept
+		{
+			if (value.size() < BlockSize)
+			{
+				// Short values cannot fill a block so check them directly and stop at the first match
+				for (auto location = offset; location < value.size(); location++)
+				{
+					if (value[location] == first || value[location] == second)
+						return location;
+				}
+
+				return std::string_view::npos;
+			}
+
+			for (auto location = offset; location < value.size(); location += BlockSize)
+			{
+				auto mask = GetMatchMask(kernels, value, location, first, second);
+				if (mask != 0)
+					return location + std::countr_zero(mask);
+			}
+
+			return std::string_view::npos;
+		}
+
+		/// <summary>
+		/// Find the last location that matches either character
+		/// </summary>
+		static size_t FindLast(std::string_view value, char first, char second) noexcept
+		{
+			return FindLast(GetActiveKernels(), value, first, second);
+		}
+
+		static size_t FindLast(
+			const Kernels& kernels,
+			std::string_view value,
+			char first,
+			char second) noexcept
+		{
+			auto end = value.size();
+			while (end >= BlockSize)
+			{
+				auto location = end - BlockSize;
+				auto mask = kernels.MatchMask(value.data() + location, first, second);
+				if (mask != 0)
+					return location + (BlockSize - 1) - std::countl_zero(mask);
+
+				end = location;
+			}
+
+			// Check the remaining start of the value directly and stop at the first match
+			while (end > 0)
+			{
+				end--;
+				if (value[end] == first || value[end] == second)
+					return end;
+			}
+
+			return std::string_view::npos;
+		}
+
+		/// <summary>
+		/// Invoke the callback with the location of every character that matches either character in order
+		/// </summary>
+		template<typename TCallback>
+		static void ForEachMatch(std::string_view value, char first, char second, TCallback&& callback)
+		{
+			auto& kernels = GetActiveKernels();
+			for (size_t location = 0; location < value.size(); location += BlockSize)
+			{
+				auto mask = GetMatchMask(kernels, value, location, first, second);
+				while (mask != 0)
+				{
+					callback(location + std::countr_zero(mask));
+					mask &= mask - 1;
+				}
+			}
+		}
+
+		/// <summary>
+		/// Find the length of the common prefix of the two values by comparing a block of characters at a time
+		/// </summary>
+		static size_t FindMismatch(std::string_view left, std::string_view right) noexcept
+		{
+			auto size = std::min(left.size(), right.size());
+			size_t location = 0;
+
+			#ifdef OPAL_PATH_SCAN_X64
+			// SSE2 is part of the x64 baseline so there is no need to check the processor
+			for (; location + sizeof(__m128i) <= size; location += sizeof(__m128i))
+			{
+				auto leftValue = _mm_loadu_si128(reinterpret_cast<const __m128i*>(left.data() + location));
+				auto rightValue = _mm_loadu_si128(reinterpret_cast<const __m128i*>(right.data() + location));
+				auto matches = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(leftValue, rightValue)));
+				if (matches != 0xFFFF)
+					return location + std::countr_zero(~matches);
+			}
+			#endif
+
+			if constexpr (std::endian::native == std::endian::little)
+			{
+				for (; location + sizeof(uint64_t) <= size; location += sizeof(uint64_t))
+				{
+					uint64_t leftValue;
+					uint64_t rightValue;
+					std::memcpy(&leftValue, left.data() + location, sizeof(uint64_t));
+					std::memcpy(&rightValue, right.data() + location, sizeof(uint64_t));
+					auto difference = leftValue ^ rightValue;
+					if (difference != 0)
+						return location + (std::countr_zero(difference) / 8);
+				}
+			}
+
+			while (location < size && left[location] == right[location])
+				location++;
+
+			return location;
+		}
+
+		/// <summary>
+		/// Find the length of the common prefix of the two values ignoring the case of ASCII letters
+		/// </summary>
+		static size_t FindMismatchIgnoreCase(std::string_view left, std::string_view right) noexcept
+		{
+			auto size = std::min(left.size(), right.size());
+			size_t location = 0;
+
+			#ifdef OPAL_PATH_SCAN_X64
+			for (; location + sizeof(__m128i) <= size; location += sizeof(__m128i))
+			{
+				auto leftValue = ToLowerSSE2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(left.data() + location)));
+				auto rightValue = ToLowerSSE2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(right.data() + location)));
+				auto matches = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(leftValue, rightValue)));
+				if (matches != 0xFFFF)
+					return location + std::countr_zero(~matches);
+			}
+			#endif
+
+			if constexpr (std::endian::native == std::endian::little)
+			{
+				for (; location + sizeof(uint64_t) <= size; location += sizeof(uint64_t))
+				{
+					uint64_t leftValue;
+					uint64_t rightValue;
+					std::memcpy(&leftValue, left.data() + location, sizeof(uint64_t));
+					std::memcpy(&rightValue, right.data() + location, sizeof(uint64_t));
+					auto difference = ToLower(leftValue) ^ ToLower(rightValue);
+					if (difference != 0)
+						return location + (std::countr_zero(difference) / 8);
+				}
+			}
+
+			while (location < size && ToLower(left[location]) == ToLower(right[location]))
+				location++;
+
+			return location;
+		}
+
+		/// <summary>
+		/// Convert the ASCII upper case letters to lower case, leaving all other characters unchanged
+		/// </summary>
+		static constexpr char ToLower(char value) noexcept
+		{
+			return value >= 'A' && value <= 'Z' ? static_cast<char>(value | 0x20) : value;
+		}
+
+		/// <summary>
+		/// Convert the ASCII upper case letters in eight packed characters to lower case
+		/// </summary>
+		static constexpr uint64_t ToLower(uint64_t value) noexcept
+		{
+			// Set the high bit of every character that is at least 'A' and of every character past 'Z'
+			// using only the low seven bits so the additions never carry into the next character
+			constexpr uint64_t ones = 0x0101010101010101;
+			constexpr uint64_t highBits = 0x8080808080808080;
+			auto low = value & ~highBits;
+			auto atLeastA = low + ones * (0x80 - 'A');
+			auto pastZ = low + ones * (0x80 - 'Z' - 1);
+
+			// Only characters without the high bit set can be letters
+			auto isUpper = (atLeastA ^ pastZ) & ~value & highBits;
+			return value | (isUpper >> 2);
+		}
+
+		/// <summary>
+		/// Hash the value eight characters at a time, passing each packed word through the transform
+		/// before it is mixed in so callers can fold characters without creating a copy
+		/// </summary>
+		template<typename TTransform>
+		static uint64_t HashWords(std::string_view value, TTransform transform) noexcept
+		{
+			constexpr uint64_t multiplier = 0x9E3779B97F4A7C15;
+			uint64_t result = value.size() * multiplier;
+			size_t location = 0;
+			for (; location + sizeof(uint64_t) <= value.size(); location += sizeof(uint64_t))
+			{
+				uint64_t current;
+				std::memcpy(&current, value.data() + location, sizeof(uint64_t));
+				result = (result ^ transform(current)) * multiplier;
+				result ^= result >> 29;
+			}
+
+			if (location != value.size())
+			{
+				uint64_t current = 0;
+				std::memcpy(&current, value.data() + location, value.size() - location);
+				result = (result ^ transform(current)) * multiplier;
+			}
+
+			result ^= result >> 32;
+			result *= 0xD6E8FEB86659FD93;
+			result ^= result >> 32;
+			return result;
+		}
+
+		/// <summary>
+		/// Copy the characters into the destination while swapping one character for another
+		/// Note: The source and destination may be the same buffer
+		/// </summary>
+		static void Replace(const char* source, size_t size, char* destination, char from, char to) noexcept
+		{
+			GetActiveKernels().Replace(source, size, destination, from, to);
+		}
+
+	private:
+		static const Kernels& GetActiveKernels() noexcept
+		{
+			static const Kernels value = GetKernels(GetInstructionSet());
+			return value;
+		}
+
+		/// <summary>
+		/// Get the match mask for the block that starts at the location, ignoring anything past the end
+		/// </summary>
+		static uint64_t GetMatchMask(
+			const Kernels& kernels,
+			std::string_view value,
+			size_t location,
+			char first,
+			char second) noexcept
+		{
+			auto remaining = value.size() - location;
+			if (remaining >= BlockSize)
+			{
+				return kernels.MatchMask(value.data() + location, first, second);
+			}
+			else if (value.size() >= BlockSize)
+			{
+				// Check the final full block that overlaps the previous and shift out the already checked part
+				auto mask = kernels.MatchMask(value.data() + value.size() - BlockSize, first, second);
+				return mask >> (BlockSize - remaining);
+			}
+			else
+			{
+				// Short values are checked directly since they cannot fill a block without reading past the end
+				uint64_t result = 0;
+				for (size_t i = 0; i < remaining; i++)
+				{
+					auto current = value[location + i];
+					if (current == first || current == second)
+						result |= uint64_t(1) << i;
+				}
+
+				return result;
+			}
+		}
+
+		static InstructionSet DetectInstructionSet() noexcept
+		{
+			#ifdef OPAL_PATH_SCAN_X64
+			#if defined(_MSC_VER) && !defined(__clang__)
+			// AVX2 requires the processor feature and the operating system to save the extended registers
+			int info[4];
+			__cpuid(info, 1);
+			bool hasOSXSave = (info[2] & (1 << 27)) != 0;
+			bool hasAVX = (info[2] & (1 << 28)) != 0;
+			if (hasOSXSave && hasAVX && (_xgetbv(0) & 0x6) == 0x6)
+			{
+				__cpuidex(info, 7, 0);
+				if ((info[1] & (1 << 5)) != 0)
+					return InstructionSet::AVX2;
+			}
+			#else
+			if (__builtin_cpu_supports("avx2"))
+				return InstructionSet::AVX2;
+			#endif
+
+			// SSE2 is part of the x64 baseline
+			return InstructionSet::SSE2;
+			#else
+			return InstructionSet::Scalar;
+			#endif
+		}
+
+		static uint64_t MatchMaskScalar(const char* block, char first, char second) noexcept
+		{
+			uint64_t result = 0;
+			if constexpr (std::endian::native == std::endian::little)
+			{
+				// Check eight characters at a time and gather the high bit of each matching byte
+				constexpr uint64_t ones = 0x0101010101010101;
+				constexpr uint64_t lowBits = 0x7F7F7F7F7F7F7F7F;
+				constexpr uint64_t highBits = 0x8080808080808080;
+				auto matchMask = [](uint64_t value, char match)
+				{
+					auto difference = value ^ (ones * static_cast<uint8_t>(match));
+					return ~(((difference & lowBits) + lowBits) | difference) & highBits;
+				};
+
+				for (size_t i = 0; i < BlockSize; i += sizeof(uint64_t))
+				{
+					uint64_t value;
+					std::memcpy(&value, block + i, sizeof(uint64_t));
+					auto mask = matchMask(value, first) | matchMask(value, second);
+					auto packed = ((mask >> 7) * 0x0102040810204080) >> 56;
+					result |= packed << i;
+				}
+			}
+			else
+			{
+				for (size_t i = 0; i < BlockSize; i++)
+				{
+					if (block[i] == first || block[i] == second)
+						result |= uint64_t(1) << i;
+				}
+			}
+
+			return result;
+		}
+
+		static void ReplaceScalar(const char* source, size_t size, char* destination, char from, char to) noexcept
+		{
+			for (size_t i = 0; i < size; i++)
+				destination[i] = source[i] == from ? to : source[i];
+		}
+
+		#ifdef OPAL_PATH_SCAN_X64
+		static uint64_t MatchMaskSSE2(const char* block, char first, char second) noexcept
+		{
+			auto firstValue = _mm_set1_epi8(first);
+			auto secondValue = _mm_set1_epi8(second);
+			uint64_t result = 0;
+			for (size_t i = 0; i < BlockSize; i += sizeof(__m128i))
+			{
+				auto value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + i));
+				auto matches = _mm_or_si128(_mm_cmpeq_epi8(value, firstValue), _mm_cmpeq_epi8(value, secondValue));
+				result |= static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(matches))) << i;
+			}
+
+			return result;
+		}
+
+		static void ReplaceSSE2(const char* source, size_t size, char* destination, char from, char to) noexcept
+		{
+			auto fromValue = _mm_set1_epi8(from);
+			auto toValue = _mm_set1_epi8(to);
+			size_t i = 0;
+			for (; i + sizeof(__m128i) <= size; i += sizeof(__m128i))
+			{
+				auto value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+				auto matches = _mm_cmpeq_epi8(value, fromValue);
+				auto result = _mm_or_si128(_mm_andnot_si128(matches, value), _mm_and_si128(matches, toValue));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), result);
+			}
+
+			ReplaceScalar(source + i, size - i, destination + i, from, to);
+		}
+
+		static __m128i ToLowerSSE2(__m128i value) noexcept
+		{
+			// Characters past 0x7F are negative so the signed compares never treat them as letters
+			auto isUpper = _mm_and_si128(
+				_mm_cmpgt_epi8(value, _mm_set1_epi8('A' - 1)),
+				_mm_cmplt_epi8(value, _mm_set1_epi8('Z' + 1)));
+			return _mm_or_si128(value, _mm_and_si128(isUpper, _mm_set1_epi8(0x20)));
+		}
+
+		OPAL_PATH_SCAN_TARGET_AVX2
+		static uint64_t MatchMaskAVX2(const char* block, char first, char second) noexcept
+		{
+			auto firstValue = _mm256_set1_epi8(first);
+			auto secondValue = _mm256_set1_epi8(second);
+			auto lowValue = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block));
+			auto highValue = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + sizeof(__m256i)));
+			auto lowMatches = _mm256_or_si256(_mm256_cmpeq_epi8(lowValue, firstValue), _mm256_cmpeq_epi8(lowValue, secondValue));
+			auto highMatches = _mm256_or_si256(_mm256_cmpeq_epi8(highValue, firstValue), _mm256_cmpeq_epi8(highValue, secondValue));
+			auto low = static_cast<uint32_t>(_mm256_movemask_epi8(lowMatches));
+			auto high = static_cast<uint32_t>(_mm256_movemask_epi8(highMatches));
+			return (static_cast<uint64_t>(high) << 32) | low;
+		}
+
+		OPAL_PATH_SCAN_TARGET_AVX2
+		static void ReplaceAVX2(const char* source, size_t size, char* destination, char from, char to) noexcept
+		{
+			auto fromValue = _mm256_set1_epi8(from);
+			auto toValue = _mm256_set1_epi8(to);
+			size_t i = 0;
+			for (; i + sizeof(__m256i) <= size; i += sizeof(__m256i))
+			{
+				auto value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + i));
+				auto matches = _mm256_cmpeq_epi8(value, fromValue);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + i), _mm256_blendv_epi8(value, toValue, matches));
+			}
+
+			// Finish the remainder with a single overlapping block when possible
+			// Note: Replacing is idempotent so this is safe when updating in place
+			if (i != size && size >= sizeof(__m256i))
+			{
+				i = size - sizeof(__m256i);
+				auto value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + i));
+				auto matches = _mm256_cmpeq_epi8(value, fromValue);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + i), _mm256_blendv_epi8(value, toValue, matches));
+				return;
+			}
+
+			ReplaceSSE2(source + i, size - i, destination + i, from, to);
+		}
+		#endif
+	};
+}
@@ -0,0 +1,396 @@
+﻿// <copyright file="path-storage.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+#pragma once
+
+namespace Opal
+{
+	/// <summary>
+	/// The character storage for a path value
+	/// Values that fit in the inline buffer are stored directly in the object and only
+	/// longer values spill over into a heap allocation.
+	/// Note: The value is always null terminated.
+	/// The hash of the value is cached alongside the characters and cleared whenever the value is reset.
+	/// Heap buffers are reference counted and never written while shared, so a copy only adds a
+	/// reference and the first change to a shared value moves it into a new buffer.
+	/// An optional memory resource can provide the spill allocations, which allows an arena to release
+	/// all of the storage for a group of paths at once. Copies always use the global heap while moves keep
+	/// the resource that owns the buffer, matching the polymorphic allocator containers.
+	/// </summary>
+	class PathStorage
+	{
+	public:
+		/// <summary>
+		/// The inline buffer size, including the null terminator
+		/// </summary>
+		static constexpr size_t InlineCapacity = 128;
+
+	private:
+		/// <summary>
+		/// The header placed directly before the characters of every heap buffer
+		/// </summary>
+		struct BufferHeader
+		{
+			std::atomic<size_t> ReferenceCount;
+		};
+
+		size_t _size;
+		size_t _heapCapacity;
+		char* _heap;
+		std::pmr::memory_resource* _resource;
+		mutable std::atomic<size_t> _hash;
+		char _inline[InlineCapacity];
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref="PathStorage"/> class.
+		/// </summary>
+		PathStorage() noexcept :
+			_size(0),
+			_heapCapacity(0),
+			_heap(nullptr),
+			_resource(nullptr),
+			_hash(0)
+		{
+			_inline[0] = '\0';
+		}
+
+		PathStorage(std::string_view value) :
+			_size(0),
+			_heapCapacity(0),
+			_heap(nullptr),
+			_resource(nullptr),
+			_hash(0)
+		{
+			Assign(value);
+		}
+
+		PathStorage(std::string_view value, std::pmr::memory_resource* resource) :
+			_size(0),
+			_heapCapacity(0),
+			_heap(nullptr),
+			_resource(resource),
+			_hash(0)
+		{
+			Assign(value);
+		}
+
+		PathStorage(const PathStorage& other) :
+			_size(0),
+			_heapCapacity(0),
+			_heap(nullptr),
+			_resource(nullptr),
+			_hash(0)
+		{
+			CopyFrom(other);
+		}
+
+		PathStorage(PathStorage&& other) noexcept :
+			_size(0),
+			_heapCapacity(0),
+			_heap(nullptr),
+			_resource(nullptr),
+			_hash(0)
+		{
+			MoveFrom(other);
+		}
+
+		~PathStorage()
+		{
+			Deallocate();
+		}
+
+		PathStorage& operator=(const PathStorage& other)
+		{
+			if (this != &other)
+			{
+				CopyFrom(other);
+			}
+
+			return *this;
+		}
+
+		/// <summary>
+		/// Move the value when both storages use the same memory resource, otherwise copy it,
+		/// which may allocate and throw
+		/// </summary>
+		PathStorage& operator=(PathStorage&& other)
+		{
+			if (this != &other)
+			{
+				if (_resource == other._resource)
+				{
+					Deallocate();
+					MoveFrom(other);
+				}
+				else
+				{
+					// A buffer cannot change owners so copy into the current storage
+					Assign(other.ToStringView());
+					SetCachedHash(other.GetCachedHash());
+				}
+			}
+
+			return *this;
+		}
+
+		/// <summary>
+		/// Gets a value indicating whether the value is stored in the inline buffer
+		/// </summary>
+		bool IsInline() const noexcept
+		{
+			return _heap == nullptr;
+		}
+
+		/// <summary>
+		/// Gets a value indicating whether the heap buffer is referenced by more than one storage
+		/// </summary>
+		bool IsShared() const noexcept
+		{
+			return _heap != nullptr && GetHeader().ReferenceCount.load(std::memory_order_acquire) != 1;
+		}
+
+		/// <summary>
+		/// Gets the memory resource used for spill allocations, null when using the global heap
+		/// </summary>
+		std::pmr::memory_resource* GetMemoryResource() const noexcept
+		{
+			return _resource;
+		}
+
+		size_t GetSize() const noexcept
+		{
+			return _size;
+		}
+
+		const char* GetData() const noexcept
+		{
+			return _heap != nullptr ? _heap : _inline;
+		}
+
+		std::string_view ToStringView() const noexcept
+		{
+			return std::string_view(GetData(), _size);
+		}
+
+		/// <summary>
+		/// Gets the cached hash of the value, zero when not yet calculated
+		/// </summary>
+		size_t GetCachedHash() const noexcept
+		{
+			return _hash.load(std::memory_order_relaxed);
+		}
+
+		/// <summary>
+		/// Store the calculated hash of the value
+		/// Note: Safe to call from concurrent readers since every caller stores the same value
+		/// </summary>
+		void SetCachedHash(size_t value) const noexcept
+		{
+			_hash.store(value, std::memory_order_relaxed);
+		}
+
+		/// <summary>
+		/// Replace the value with a copy of the provided string
+		/// </summary>
+		void Assign(std::string_view value)
+		{
+			if (IsShared())
+			{
+				// Copy into a new buffer before letting go of the shared one since the value may reference it
+				*this = PathStorage(value);
+				return;
+			}
+
+			// Note: Value may alias the current buffer when shrinking in place
+			auto buffer = Reset(value.size());
+			std::memmove(buffer, value.data(), value.size());
+		}
+
+		/// <summary>
+		/// Resize the storage to hold exactly the requested number of characters and return the
+		/// writable buffer, the caller is responsible for filling in the contents.
+		/// The existing contents are only preserved when the buffer does not need to grow and is not shared.
+		/// </summary>
+		char* Reset(size_t size)
+		{
+			SetCachedHash(0);
+
+			// Never write to a shared buffer
+			if (IsShared())
+				Deallocate();
+
+			if (size < InlineCapacity)
+			{
+				// Prefer to stay in an existing heap buffer to avoid churn
+				if (_heap == nullptr)
+				{
+					_size = size;
+					_inline[size] = '\0';
+					return _inline;
+				}
+			}
+
+			if (_heap == nullptr || size > _heapCapacity)
+			{
+				Deallocate();
+				_heap = Allocate(size);
+				_heapCapacity = size;
+			}
+
+			_size = size;
+			_heap[size] = '\0';
+			return _heap;
+		}
+
+		/// <summary>
+		/// Resize the storage, keeping the existing contents up to the smaller of the two sizes, and return
+		/// the writable buffer. The value is changed in place when it fits in the current buffer and is not
+		/// shared, otherwise the kept contents are moved into a single new buffer.
+		/// </summary>
+		char* Resize(size_t size)
+		{
+			SetCachedHash(0);
+
+			bool fits = _heap == nullptr ? size < InlineCapacity : size <= _heapCapacity;
+			if (!fits || IsShared())
+			{
+				auto keepSize = std::min(size, _size);
+				if (size < InlineCapacity)
+				{
+					// Only a shared heap buffer can move back inline
+					std::memcpy(_inline, _heap, keepSize);
+					Deallocate();
+				}
+				else
+				{
+					auto buffer = Allocate(size);
+					std::memcpy(buffer, GetData(), keepSize);
+					Deallocate();
+					_heap = buffer;
+					_heapCapacity = size;
+				}
+			}
+
+			_size = size;
+			auto buffer = GetData();
+			buffer[size] = '\0';
+			return buffer;
+		}
+
+		/// <summary>
+		/// Shrink the value, keeping the existing contents up to the new size
+		/// </summary>
+		void Truncate(size_t size)
+		{
+			if (IsShared())
+			{
+				Assign(ToStringView().substr(0, size));
+				return;
+			}
+
+			SetCachedHash(0);
+			_size = size;
+			GetData()[size] = '\0';
+		}
+
+	private:
+		char* GetData() noexcept
+		{
+			return _heap != nullptr ? _heap : _inline;
+		}
+
+		BufferHeader& GetHeader() const noexcept
+		{
+			return *reinterpret_cast<BufferHeader*>(_heap - sizeof(BufferHeader));
+		}
+
+		static size_t GetAllocationSize(size_t capacity) noexcept
+		{
+			return sizeof(BufferHeader) + capacity + 1;
+		}
+
+		/// <summary>
+		/// Allocate a heap buffer with a single reference that can hold the requested number of characters
+		/// </summary>
+		char* Allocate(size_t capacity)
+		{
+			auto size = GetAllocationSize(capacity);
+			auto allocation = _resource != nullptr ?
+				_resource->allocate(size, alignof(BufferHeader)) :
+				::operator new(size);
+			new (allocation) BufferHeader{ 1 };
+			return static_cast<char*>(allocation) + sizeof(BufferHeader);
+		}
+
+		/// <summary>
+		/// Release the reference to the heap buffer, freeing it when this was the last one
+		/// </summary>
+		void Deallocate() noexcept
+		{
+			if (_heap != nullptr)
+			{
+				auto& header = GetHeader();
+				if (header.ReferenceCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+				{
+					header.~BufferHeader();
+					if (_resource != nullptr)
+						_resource->deallocate(&header, GetAllocationSize(_heapCapacity), alignof(BufferHeader));
+					else
+						::operator delete(&header);
+				}
+
+				_heap = nullptr;
+				_heapCapacity = 0;
+			}
+		}
+
+		/// <summary>
+		/// Copy the value, sharing the heap buffer when both use the global heap
+		/// Note: A buffer from a memory resource is never shared so a copy can outlive the resource
+		/// </summary>
+		void CopyFrom(const PathStorage& other)
+		{
+			if (other._heap != nullptr && other._resource == nullptr && _resource == nullptr)
+			{
+				other.GetHeader().ReferenceCount.fetch_add(1, std::memory_order_relaxed);
+				Deallocate();
+				_heap = other._heap;
+				_heapCapacity = other._heapCapacity;
+				_size = other._size;
+			}
+			else
+			{
+				Assign(other.ToStringView());
+			}
+
+			SetCachedHash(other.GetCachedHash());
+		}
+
+		/// <summary>
+		/// Take over the value and the memory resource that owns it, the current buffer must already be released
+		/// </summary>
+		void MoveFrom(PathStorage& other) noexcept
+		{
+			_size = other._size;
+			_resource = other._resource;
+			SetCachedHash(other.GetCachedHash());
+			if (other._heap != nullptr)
+			{
+				// Steal the heap allocation
+				_heap = other._heap;
+				_heapCapacity = other._heapCapacity;
+				other._heap = nullptr;
+				other._heapCapacity = 0;
+			}
+			else
+			{
+				std::memcpy(_inline, other._inline, other._size + 1);
+			}
+
+			other._size = 0;
+			other._inline[0] = '\0';
+			other.SetCachedHash(0);
+		}
+	};
+}
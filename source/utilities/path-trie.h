@@ -0,0 +1,456 @@
+﻿// <copyright file="path-trie.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+#pragma once
+#include "path-map.h"
+
+namespace Opal
+{
+	/// <summary>
+	/// A prefix tree of values keyed on the components of a path
+	/// Each node is a single root, directory or file name component. Lookups walk one component at a
+	/// time through a shared hash index of the children so the cost is proportional to the path depth.
+	/// Nodes are stored in a flat list linked by index and the component names are packed into a single
+	/// buffer to keep large trees compact.
+	/// Note: A directory and a file with the same components are the same key.
+	/// Note: The name buffer is not compacted when nodes are removed.
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	template<typename TValue>
+	class PathTrie
+	{
+	private:
+		static constexpr uint32_t NoNode = std::numeric_limits<uint32_t>::max();
+
+		struct Node
+		{
+			uint32_t Parent;
+			uint32_t FirstChild;
+			uint32_t NextSibling;
+			uint32_t PreviousSibling;
+			uint32_t NameOffset;
+			uint32_t NameSize : 31;
+			uint32_t IsFile : 1;
+			uint32_t ValueIndex;
+		};
+
+		std::vector<Node> _nodes;
+		std::vector<uint32_t> _freeNodes;
+		std::vector<std::pair<uint32_t, TValue>> _values;
+		std::string _names;
+		HashIndex _children;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref="PathTrie"/> class.
+		/// </summary>
+		PathTrie() :
+			_nodes(),
+			_freeNodes(),
+			_values(),
+			_names(),
+			_children()
+		{
+			// The top node has no name and holds the roots and first relative directories
+			_nodes.push_back({ NoNode, NoNode, NoNode, NoNode, 0, 0, 0, NoNode });
+		}
+
+		/// <summary>
+		/// Gets the number of values
+		/// </summary>
+		size_t GetCount() const noexcept
+		{
+			return _values.size();
+		}
+
+		bool Contains(const Path& key) const
+		{
+			auto node = FindNode(key);
+			return node != NoNode && _nodes[node].ValueIndex != NoNode;
+		}
+
+		void Insert(const Path& key, TValue value)
+		{
+			auto [wasInserted, valueReference] = TryInsert(key, std::move(value));
+			if (!wasInserted)
+			{
+				throw std::runtime_error("Key already exists");
+			}
+		}
+
+		std::pair<bool, TValue*> TryInsert(const Path& key, TValue value)
+		{
+			// Walk down the components and add any missing nodes
+			uint32_t node = 0;
+			for (auto component : key.GetComponents())
+			{
+				auto child = FindChild(node, component);
+				if (child == NoNode)
+					child = AddChild(node, component);
+				node = child;
+			}
+
+			auto& current = _nodes[node];
+			if (current.ValueIndex != NoNode)
+				return std::make_pair<bool, TValue*>(false, nullptr);
+
+			current.IsFile = key.HasFileName() ? 1 : 0;
+			current.ValueIndex = static_cast<uint32_t>(_values.size());
+			auto& entry = _values.emplace_back(node, std::move(value));
+			return std::make_pair<bool, TValue*>(true, &entry.second);
+		}
+
+		bool TryGet(const Path& key, TValue*& value)
+		{
+			return TryGetValue(FindNode(key), value);
+		}
+
+		bool TryGet(const Path& key, const TValue*& value) const
+		{
+			return TryGetValue(FindNode(key), value);
+		}
+
+		/// <summary>
+		/// Find the value for the longest key that is a prefix of the provided path, including the path itself
+		/// </summary>
+		bool TryGetLongestPrefix(const Path& path, TValue*& value)
+		{
+			return TryGetValue(FindLongestPrefix(path), value);
+		}
+
+		bool TryGetLongestPrefix(const Path& path, const TValue*& value) const
+		{
+			return TryGetValue(FindLongestPrefix(path), value);
+		}
+
+		/// <summary>
+		/// Invoke the callback with every key and value at or below the directory
+		/// Note: The key view is only valid for the duration of the callback
+		/// </summary>
+		template<typename TCallback>
+		void ForEachInSubtree(const Path& directory, TCallback&& callback)
+		{
+			VisitSubtree(FindNode(directory), [&](uint32_t node, std::string_view key)
+			{
+				callback(PathView(key), _values[_nodes[node].ValueIndex].second);
+			});
+		}
+
+		template<typename TCallback>
+		void ForEachInSubtree(const Path& directory, TCallback&& callback) const
+		{
+			VisitSubtree(FindNode(directory), [&](uint32_t node, std::string_view key)
+			{
+				const auto& value = _values[_nodes[node].ValueIndex].second;
+				callback(PathView(key), value);
+			});
+		}
+
+		/// <summary>
+		/// Remove the value for the key if present
+		/// </summary>
+		bool Erase(const Path& key)
+		{
+			auto node = FindNode(key);
+			if (node == NoNode || _nodes[node].ValueIndex == NoNode)
+				return false;
+
+			RemoveValue(node);
+			Prune(node);
+			return true;
+		}
+
+		/// <summary>
+		/// Remove the directory and everything below it, returning the number of values removed
+		/// </summary>
+		size_t EraseSubtree(const Path& directory)
+		{
+			auto start = FindNode(directory);
+			if (start == NoNode)
+				return 0;
+
+			// Collect the nodes first since removing them breaks the links used to walk the tree
+			auto nodes = std::vector<uint32_t>();
+			Walk(start, [&](uint32_t node) { nodes.push_back(node); });
+
+			size_t count = 0;
+			for (auto node : nodes)
+			{
+				if (_nodes[node].ValueIndex != NoNode)
+				{
+					RemoveValue(node);
+					count++;
+				}
+			}
+
+			auto parent = _nodes[start].Parent;
+			Unlink(start);
+			for (auto node : nodes)
+				FreeNode(node);
+
+			Prune(parent);
+			return count;
+		}
+
+		void Clear()
+		{
+			_nodes.resize(1);
+			_nodes[0] = { NoNode, NoNode, NoNode, NoNode, 0, 0, 0, NoNode };
+			_freeNodes.clear();
+			_values.clear();
+			_names.clear();
+			_children.Clear();
+		}
+
+	private:
+		std::string_view GetName(uint32_t node) const noexcept
+		{
+			const auto& current = _nodes[node];
+			return std::string_view(_names.data() + current.NameOffset, current.NameSize);
+		}
+
+		static size_t GetChildHash(uint32_t parent, std::string_view name) noexcept
+		{
+			return std::hash<std::string_view>()(name) ^ (static_cast<size_t>(parent) * 0x9E3779B97F4A7C15);
+		}
+
+		uint32_t FindChild(uint32_t parent, std::string_view name) const
+		{
+			auto slot = _children.FindSlot(
+				GetChildHash(parent, name),
+				[&](size_t node) { return _nodes[node].Parent == parent && GetName(static_cast<uint32_t>(node)) == name; });
+			return slot != HashIndex::NotFound ? static_cast<uint32_t>(_children.GetPosition(slot)) : NoNode;
+		}
+
+		uint32_t FindNode(const Path& key) const
+		{
+			uint32_t node = 0;
+			for (auto component : key.GetComponents())
+			{
+				node = FindChild(node, component);
+				if (node == NoNode)
+					return NoNode;
+			}
+
+			return node;
+		}
+
+		uint32_t FindLongestPrefix(const Path& path) const
+		{
+			auto result = NoNode;
+			uint32_t node = 0;
+			for (auto component : path.GetComponents())
+			{
+				node = FindChild(node, component);
+				if (node == NoNode)
+					break;
+				if (_nodes[node].ValueIndex != NoNode)
+					result = node;
+			}
+
+			return result;
+		}
+
+		bool TryGetValue(uint32_t node, TValue*& value)
+		{
+			if (node == NoNode || _nodes[node].ValueIndex == NoNode)
+			{
+				value = nullptr;
+				return false;
+			}
+
+			value = &_values[_nodes[node].ValueIndex].second;
+			return true;
+		}
+
+		bool TryGetValue(uint32_t node, const TValue*& value) const
+		{
+			if (node == NoNode || _nodes[node].ValueIndex == NoNode)
+			{
+				value = nullptr;
+				return false;
+			}
+
+			value = &_values[_nodes[node].ValueIndex].second;
+			return true;
+		}
+
+		uint32_t AddChild(uint32_t parent, std::string_view name)
+		{
+			if (_names.size() + name.size() > std::numeric_limits<uint32_t>::max())
+				throw std::runtime_error("Path trie name buffer overflow");
+
+			uint32_t node;
+			if (!_freeNodes.empty())
+			{
+				node = _freeNodes.back();
+				_freeNodes.pop_back();
+			}
+			else
+			{
+				if (_nodes.size() >= NoNode)
+					throw std::runtime_error("Path trie node overflow");
+
+				node = static_cast<uint32_t>(_nodes.size());
+				_nodes.emplace_back();
+			}
+
+			// Link in as the first child
+			auto firstChild = _nodes[parent].FirstChild;
+			_nodes[node] = {
+				parent,
+				NoNode,
+				firstChild,
+				NoNode,
+				static_cast<uint32_t>(_names.size()),
+				static_cast<uint32_t>(name.size()),
+				0,
+				NoNode,
+			};
+			if (firstChild != NoNode)
+				_nodes[firstChild].PreviousSibling = node;
+			_nodes[parent].FirstChild = node;
+
+			_names.append(name);
+
+			if (_children.NeedsGrowth(_nodes.size()))
+				_children.Rebuild(_nodes.size() * 2);
+			_children.Insert(GetChildHash(parent, name), node);
+
+			return node;
+		}
+
+		/// <summary>
+		/// Remove the value from the node, moving the last value into its place
+		/// </summary>
+		void RemoveValue(uint32_t node)
+		{
+			auto index = _nodes[node].ValueIndex;
+			auto last = static_cast<uint32_t>(_values.size() - 1);
+			if (index != last)
+			{
+				_values[index] = std::move(_values[last]);
+				_nodes[_values[index].first].ValueIndex = index;
+			}
+
+			_values.pop_back();
+			_nodes[node].ValueIndex = NoNode;
+		}
+
+		/// <summary>
+		/// Detach the node from its parent and siblings
+		/// </summary>
+		void Unlink(uint32_t node)
+		{
+			auto& current = _nodes[node];
+			if (current.PreviousSibling != NoNode)
+				_nodes[current.PreviousSibling].NextSibling = current.NextSibling;
+			else
+				_nodes[current.Parent].FirstChild = current.NextSibling;
+
+			if (current.NextSibling != NoNode)
+				_nodes[current.NextSibling].PreviousSibling = current.PreviousSibling;
+		}
+
+		void FreeNode(uint32_t node)
+		{
+			auto slot = _children.FindSlot(
+				GetChildHash(_nodes[node].Parent, GetName(node)),
+				[&](size_t position) { return position == node; });
+			_children.Erase(slot);
+			_freeNodes.push_back(node);
+		}
+
+		/// <summary>
+		/// Remove the node and any ancestors that no longer have a value or children
+		/// </summary>
+		void Prune(uint32_t node)
+		{
+			while (node != 0 && _nodes[node].ValueIndex == NoNode && _nodes[node].FirstChild == NoNode)
+			{
+				auto parent = _nodes[node].Parent;
+				Unlink(node);
+				FreeNode(node);
+				node = parent;
+			}
+		}
+
+		/// <summary>
+		/// Visit the node and all of its descendants depth first without recursion
+		/// </summary>
+		template<typename TCallback>
+		void Walk(uint32_t start, TCallback&& callback) const
+		{
+			auto node = start;
+			while (true)
+			{
+				callback(node);
+				if (_nodes[node].FirstChild != NoNode)
+				{
+					node = _nodes[node].FirstChild;
+					continue;
+				}
+
+				// Move to the next sibling of the closest ancestor that has one
+				while (node != start && _nodes[node].NextSibling == NoNode)
+					node = _nodes[node].Parent;
+				if (node == start)
+					return;
+
+				node = _nodes[node].NextSibling;
+			}
+		}
+
+		/// <summary>
+		/// Visit every node with a value at or below the start node along with its key
+		/// </summary>
+		template<typename TCallback>
+		void VisitSubtree(uint32_t start, TCallback&& callback) const
+		{
+			if (start == NoNode)
+				return;
+
+			// Build the directory string for the start node from its ancestors
+			auto ancestors = std::vector<uint32_t>();
+			for (auto node = start; node != 0; node = _nodes[node].Parent)
+				ancestors.push_back(node);
+
+			auto key = std::string();
+			for (auto node = ancestors.rbegin(); node != ancestors.rend(); ++node)
+			{
+				key.append(GetName(*node));
+				key.push_back('/');
+			}
+
+			// Keep the key in sync with the walk by tracking the chain of nodes below the start
+			auto chain = std::vector<uint32_t>();
+			Walk(start, [&](uint32_t node)
+			{
+				if (node != start)
+				{
+					// Trim the key back to the parent before adding this node
+					while (!chain.empty() && chain.back() != _nodes[node].Parent)
+					{
+						key.resize(key.size() - GetName(chain.back()).size() - 1);
+						chain.pop_back();
+					}
+
+					key.append(GetName(node));
+					key.push_back('/');
+					chain.push_back(node);
+				}
+
+				if (_nodes[node].ValueIndex != NoNode)
+				{
+					auto value = std::string_view(key);
+					if (_nodes[node].IsFile)
+						value.remove_suffix(1);
+
+					callback(node, value);
+				}
+			});
+		}
+	};
+}
@@ -0,0 +1,452 @@
+﻿// <copyright file="path-view.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+#pragma once
+#include "path-component-range.h"
+#include "path-scan.h"
+
+namespace Opal
+{
+	class Path;
+	class PathListReader;
+	class PathListWriter;
+	class RelativePathResolver;
+
+	/// <summary>
+	/// A non-owning view of a path string that shares the read only interface of <see cref="Path"/>
+	/// The referenced characters must outlive the view. Operations that build a new path value
+	/// require promoting the view into an owning <see cref="Path"/>.
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	class PathView
+	{
+	private:
+		static constexpr char DirectorySeparator = '/';
+		static constexpr char AlternateDirectorySeparator = '\\';
+		static constexpr char LetterDriveSpecifier = ':';
+		static constexpr char FileExtensionSeparator = '.';
+		static constexpr std::string_view RelativeDirectory = ".";
+		static constexpr std::string_view RelativeParentDirectory = "..";
+
+		friend class Path;
+		friend class PathListParser;
+		friend class PathListReader;
+		friend class PathListWriter;
+		friend class RelativePathResolver;
+
+	private:
+		std::string_view _value;
+		int _rootEndLocation;
+		size_t _fileNameStartLocation;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref="PathView"/> class.
+		/// </summary>
+		constexpr PathView() noexcept :
+			_value("./"),
+			_rootEndLocation(-1),
+			_fileNameStartLocation(2)
+		{
+		}
+
+		/// <summary>
+		/// Initializes a new instance of the <see cref="PathView"/> class.
+		/// </summary>
+		PathView(const char* value) :
+			_value(value),
+			_rootEndLocation(),
+			_fileNameStartLocation()
+		{
+			LoadDirect();
+		}
+		PathView(std::string_view value) :
+			_value(value),
+			_rootEndLocation(),
+			_fileNameStartLocation()
+		{
+			LoadDirect();
+		}
+
+		/// <summary>
+		/// Create a view over the value without throwing when it is not a valid path
+		/// Note: The result is left unchanged when the value is invalid
+		/// </summary>
+		static bool TryCreate(std::string_view value, PathView& result) noexcept
+		{
+			auto view = PathView(value, -1, 0);
+			if (!view.TryLoadLocations())
+				return false;
+
+			result = view;
+			return true;
+		}
+
+		/// <summary>
+		/// Gets a value indicating whether the path is empty
+		/// </summary>
+		constexpr bool IsEmpty() const noexcept
+		{
+			return _value == "./";
+		}
+
+		/// <summary>
+		/// Gets a value indicating whether the path has a root
+		/// </summary>
+		constexpr bool HasRoot() const noexcept
+		{
+			return _rootEndLocation >= 0;
+		}
+
+		/// <summary>
+		/// Gets the path root
+		/// </summary>
+		constexpr std::string_view GetRoot() const
+		{
+			if (!HasRoot())
+				throw std::runtime_error("Cannot access root on path that has none");
+
+			return _value.substr(0, _rootEndLocation);
+		}
+
+		/// <summary>
+		/// Gets the path root without throwing, returns false when the path has none
+		/// </summary>
+		constexpr bool TryGetRoot(std::string_view& root) const noexcept
+		{
+			if (!HasRoot())
+				return false;
+
+			root = _value.substr(0, _rootEndLocation);
+			return true;
+		}
+
+		/// <summary>
+		/// Gets a value indicating whether the path has a file name
+		/// </summary>
+		constexpr bool HasFileName() const noexcept
+		{
+			return _fileNameStartLocation < _value.size();
+		}
+
+		/// <summary>
+		/// Gets the file name
+		/// </summary>
+		constexpr std::string_view GetFileName() const
+		{
+			if (!HasFileName())
+				throw std::runtime_error("Cannot access file name on path that has none");
+
+			// Use the start location to return the end of the value that is the filename
+			return _value.substr(_fileNameStartLocation);
+		}
+
+		/// <summary>
+		/// Gets the file name without throwing, returns false when the path has none
+		/// </summary>
+		constexpr bool TryGetFileName(std::string_view& fileName) const noexcept
+		{
+			if (!HasFileName())
+				return false;
+
+			fileName = _value.substr(_fileNameStartLocation);
+			return true;
+		}
+
+		/// <summary>
+		/// Gets a value indicating whether the file name has an stem
+		/// </summary>
+		constexpr bool HasFileStem() const
+		{
+			return HasFileName() && !GetFileStem().empty();
+		}
+
+		/// <summary>
+		/// Gets the file name minus the extension
+		/// </summary>
+		constexpr std::string_view GetFileStem() const
+		{
+			// Everything before the last period is the stem
+			auto fileName = GetFileName();
+			auto lastSeparator = fileName.find_last_of(FileExtensionSeparator);
+			if (lastSeparator != std::string::npos)
+			{
+				return fileName.substr(0, lastSeparator);
+			}
+			else
+			{
+				// Return the entire filename if no extension
+				return fileName;
+			}
+		}
+
+		/// <summary>
+		/// Gets a value indicating whether the file name has an extension
+		/// </summary>
+		constexpr bool HasFileExtension() const
+		{
+			return HasFileName() && !GetFileExtension().empty();
+		}
+
+		/// <summary>
+		/// Gets the file extension
+		/// </summary>
+		constexpr std::string_view GetFileExtension() const
+		{
+			// Everything after and including the last period is the extension
+			auto fileName = GetFileName();
+			auto lastSeparator = fileName.find_last_of(FileExtensionSeparator);
+			if (lastSeparator != std::string::npos)
+			{
+				return fileName.substr(lastSeparator);
+			}
+			else
+			{
+				// Return the empty string
+				return "";
+			}
+		}
+
+		/// <summary>
+		/// Get a lazy range over the root, directories and file name of the path
+		/// </summary>
+		PathComponentRange GetComponents() const noexcept
+		{
+			return PathComponentRange(_value, _rootEndLocation, _fileNameStartLocation);
+		}
+
+		/// <summary>
+		/// Equality operator
+		/// </summary>
+		constexpr bool operator ==(const PathView& rhs) const noexcept
+		{
+			return _value == rhs._value;
+		}
+
+		constexpr bool operator !=(const PathView& rhs) const noexcept
+		{
+			return _value != rhs._value;
+		}
+
+		constexpr bool operator <(const PathView& rhs) const noexcept
+		{
+			return _value < rhs._value;
+		}
+
+		/// <summary>
+		/// Gets a hash of the path value that matches the cached hash of an equal <see cref="Path"/>
+		/// </summary>
+		size_t GetHash() const noexcept
+		{
+			return ComputeHash(_value);
+		}
+
+		/// <summary>
+		/// Get the referenced string value
+		/// </summary>
+		constexpr std::string_view ToStringView() const noexcept
+		{
+			return _value;
+		}
+
+		/// <summary>
+		/// Convert to string
+		/// </summary>
+		std::string ToString() const
+		{
+			return std::string(_value);
+		}
+
+		/// <summary>
+		/// Validate a constant value and compute the root and file name locations at compile time
+		/// Note: A literal is used without parsing so it must already be in the normalized form
+		/// </summary>
+		static consteval PathView CreateLiteral(std::string_view value)
+		{
+			if (value.find(AlternateDirectorySeparator) != std::string_view::npos)
+				throw std::runtime_error("A path literal must only use the directory separator");
+
+			auto firstSeparator = value.find(DirectorySeparator);
+			if (firstSeparator == std::string_view::npos)
+				throw std::runtime_error("A path must have a directory separator");
+
+			int rootEndLocation;
+			auto root = value.substr(0, firstSeparator);
+			if (root.empty() || (root.size() == 2 && IsDriveLetter(root[0]) && root[1] == LetterDriveSpecifier))
+			{
+				// Absolute path
+				rootEndLocation = (int)firstSeparator;
+			}
+			else if (root == RelativeDirectory || root == RelativeParentDirectory)
+			{
+				// Relative path
+				rootEndLocation = -1;
+			}
+			else
+			{
+				throw std::runtime_error("Unknown directory root");
+			}
+
+			auto fileNameStartLocation = value.rfind(DirectorySeparator) + 1;
+
+			// Verify the directories match what parsing would produce
+			auto previousDirectory = std::string_view();
+			auto directoriesStart = rootEndLocation >= 0 ? firstSeparator + 1 : 0;
+			auto location = directoriesStart;
+			while (location < fileNameStartLocation)
+			{
+				auto directoryEnd = value.find(DirectorySeparator, location);
+				auto directory = value.substr(location, directoryEnd - location);
+				bool isFirst = location == directoriesStart;
+				if (directory.empty())
+					throw std::runtime_error("A path literal cannot contain empty directories");
+				if (directory == RelativeDirectory && !(isFirst && rootEndLocation < 0))
+					throw std::runtime_error("A path literal can only start with the relative directory");
+				if (directory == RelativeParentDirectory && !isFirst && previousDirectory != RelativeParentDirectory)
+					throw std::runtime_error("A path literal can only have parent directories at the start");
+
+				previousDirectory = directory;
+				location = directoryEnd + 1;
+			}
+
+			auto fileName = value.substr(fileNameStartLocation);
+			if (fileName == RelativeDirectory || fileName == RelativeParentDirectory)
+				throw std::runtime_error("A path literal file name cannot be a relative directory");
+
+			return PathView(value, rootEndLocation, fileNameStartLocation);
+		}
+
+	private:
+		/// <summary>
+		/// Initialize from a known valid value with precomputed locations
+		/// </summary>
+		constexpr PathView(std::string_view value, int rootEndLocation, size_t fileNameStartLocation) noexcept :
+			_value(value),
+			_rootEndLocation(rootEndLocation),
+			_fileNameStartLocation(fileNameStartLocation)
+		{
+		}
+
+		/// <summary>
+		/// Hash the value eight characters at a time
+		/// Note: Never returns zero so that it can be used to mark a hash that has not been calculated
+		/// </summary>
+		static size_t ComputeHash(std::string_view value) noexcept
+		{
+			auto hash = static_cast<size_t>(PathScan::HashWords(value, [](uint64_t word) { return word; }));
+			return hash != 0 ? hash : 1;
+		}
+
+		static constexpr bool IsDriveLetter(char value)
+		{
+			return (value >= 'A' && value <= 'Z') || (value >= 'a' && value <= 'z');
+		}
+
+		/// <summary>
+		/// Helper that validates the value and computes the root and file name locations
+		/// </summary>
+		void LoadDirect()
+		{
+			#ifdef _DEBUG
+			auto firstAlternateDirectory = PathScan::FindFirst(_value, 0, AlternateDirectorySeparator, AlternateDirectorySeparator);
+			if (firstAlternateDirectory != std::string::npos)
+				throw std::runtime_error("Debug check for windows ridiculous directory separator");
+			#endif
+
+			if (!TryLoadLocations())
+			{
+				// Find the reason for the failure off the hot path
+				auto firstSeparator = _value.find_first_of(DirectorySeparator);
+				if (firstSeparator == std::string::npos)
+				{
+					throw std::runtime_error("A path must have a directory separator");
+				}
+
+				throw std::runtime_error(std::format("Unknown directory root {}", _value.substr(0, firstSeparator)));
+			}
+		}
+
+		/// <summary>
+		/// Compute the root and file name locations, returns false when the value is not a valid path
+		/// </summary>
+		bool TryLoadLocations() noexcept
+		{
+			auto firstSeparator = _value.find_first_of(DirectorySeparator);
+			if (firstSeparator == std::string::npos)
+			{
+				return false;
+			}
+
+			auto root = _value.substr(0, firstSeparator);
+			if (IsRoot(root))
+			{
+				// Absolute path
+				_rootEndLocation = (int)firstSeparator;
+			}
+			else if (root == RelativeDirectory || root == RelativeParentDirectory)
+			{
+				// Relative path
+				_rootEndLocation = -1;
+			}
+			else
+			{
+				return false;
+			}
+
+			// Check if has file name
+			auto lastSeparator = PathScan::FindLast(_value, DirectorySeparator, DirectorySeparator);
+			if (lastSeparator != std::string::npos && lastSeparator != _value.size() - 1)
+			{
+				_fileNameStartLocation = lastSeparator + 1;
+			}
+			else
+			{
+				_fileNameStartLocation = _value.size();
+			}
+
+			return true;
+		}
+
+		static bool IsRoot(std::string_view value) noexcept
+		{
+			if (value.size() == 0)
+			{
+				// Linux root
+				return true;
+			}
+			else if (value.size() == 2)
+			{
+				// Check for drive letter
+				if (std::isalpha(static_cast<unsigned char>(value[0])) && value[1] == LetterDriveSpecifier)
+				{
+					return true;
+				}
+			}
+
+			return false;
+		}
+	};
+
+	/// <summary>
+	/// Create a path view from a literal that is validated at compile time
+	/// An invalid or non-normalized literal is a compile error
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	consteval PathView operator""_path(const char* value, size_t size)
+	{
+		return PathView::CreateLiteral(std::string_view(value, size));
+	}
+}
+
+template<>
+struct std::hash<Opal::PathView>
+{
+	size_t operator()(const Opal::PathView& value) const noexcept
+	{
+		return value.GetHash();
+	}
+};
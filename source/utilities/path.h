@@ -2,6 +2,9 @@
 // Copyright (c) Soup. All rights reserved.
 // </copyright>
 #pragma once
+#include "path-component-range.h"
+#include "path-storage.h"
+#include "path-view.h"
 
 namespace Opal
 {
@@ -12,6 +15,10 @@ namespace Opal
 	///  '/' - Rooted in the current drive
 	///  'A-Z:' - Rooted in a letter drive (Windows Specific)
 	///  '//' - Server root
+	/// A path can allocate any storage that does not fit inline from a memory resource, such as a
+	/// std::pmr::monotonic_buffer_resource for a group of paths that all share the same lifetime.
+	/// Paths built from an existing path (concatenate, parent, relative) use the same resource, while
+	/// copies always go back to the global heap so they are safe to keep past the lifetime of the resource.
 	/// </summary>
 	#ifdef SOUP_BUILD
 	export
@@ -21,7 +28,6 @@ namespace Opal
 	private:
 		static constexpr char DirectorySeparator = '/';
 		static constexpr char AlternateDirectorySeparator = '\\';
-		static constexpr std::string_view AllValidDirectorySeparators = "/\\";
 		static constexpr char LetterDriveSpecifier = ':';
 		static constexpr char FileExtensionSeparator = '.';
 		static constexpr std::string_view RelativeDirectory = ".";
@@ -37,25 +43,72 @@ namespace Opal
 			return result;
 		}
 
+		/// <summary>
+		/// Parse the value into a path that allocates from the provided memory resource
+		/// Note: The resource must outlive the path and any path moved from it
+		/// </summary>
+		static Path Parse(std::string_view value, std::pmr::memory_resource* resource)
+		{
+			auto result = Path(resource);
+
+			result.ParsePath(value);
+
+			return result;
+		}
+
+		/// <summary>
+		/// Load an already normalized value into the result without throwing when it is not a valid path
+		/// The value is copied into the existing storage of the result, which keeps its memory resource
+		/// and allows reusing a single path while reading many untrusted values.
+		/// Note: The result is left unchanged when the value is invalid
+		/// </summary>
+		static bool TryCreate(std::string_view value, Path& result)
+		{
+			PathView view;
+			if (!PathView::TryCreate(value, view))
+				return false;
+
+			result._value.Assign(value);
+			result._rootEndLocation = view._rootEndLocation;
+			result._directoryCount = NoComponentIndex;
+			result._fileNameStartLocation = view._fileNameStartLocation;
+			return true;
+		}
+
 		static Path CreateWindows(const char* value)
 		{
-			return CreateWindows(std::string(value));
+			return CreateWindows(std::string_view(value));
 		}
 
 		static Path CreateWindows(std::string_view value)
 		{
-			return CreateWindows(std::string(value));
+			// Replace the separators directly in the final storage
+			auto result = Path();
+			auto buffer = result._value.Reset(value.size());
+			PathScan::Replace(value.data(), value.size(), buffer, AlternateDirectorySeparator, DirectorySeparator);
+			result.LoadDirect();
+			return result;
 		}
 
 		static Path CreateWindows(std::string&& value)
 		{
-			std::replace(value.begin(), value.end(), AlternateDirectorySeparator, DirectorySeparator);
-			return Path(std::move(value));
+			return CreateWindows(std::string_view(value));
 		}
 
 	private:
-		std::string _value;
+		/// <summary>
+		/// The number of directory end locations stored inline in the component index
+		/// </summary>
+		static constexpr size_t ComponentIndexCapacity = 11;
+		static constexpr uint8_t NoComponentIndex = 0xFF;
+
+		PathStorage _value;
 		int _rootEndLocation;
+
+		// The optional component index, holding the location of the separator after each directory
+		uint8_t _directoryCount;
+		std::array<uint8_t, ComponentIndexCapacity> _directoryEnds;
+
 		size_t _fileNameStartLocation;
 
 	public:
@@ -65,6 +118,8 @@ namespace Opal
 		Path() :
 			_value("./"),
 			_rootEndLocation(-1),
+			_directoryCount(NoComponentIndex),
+			_directoryEnds(),
 			_fileNameStartLocation(2)
 		{
 		}
@@ -73,8 +128,10 @@ namespace Opal
 		/// Initializes a new instance of the <see cref="Path"/> class.
 		/// </summary>
 		Path(const char* value) :
-			_value(value),
+			_value(std::string_view(value)),
 			_rootEndLocation(),
+			_directoryCount(NoComponentIndex),
+			_directoryEnds(),
 			_fileNameStartLocation()
 		{
 			LoadDirect();
@@ -82,24 +139,71 @@ namespace Opal
 		Path(std::string_view value) :
 			_value(value),
 			_rootEndLocation(),
+			_directoryCount(NoComponentIndex),
+			_directoryEnds(),
 			_fileNameStartLocation()
 		{
 			LoadDirect();
 		}
 		Path(std::string&& value) :
-			_value(std::move(value)),
+			_value(value),
+			_rootEndLocation(),
+			_directoryCount(NoComponentIndex),
+			_directoryEnds(),
+			_fileNameStartLocation()
+		{
+			LoadDirect();
+		}
+
+		/// <summary>
+		/// Initializes a new instance of the <see cref="Path"/> class that allocates from the provided memory resource.
+		/// Note: The resource must outlive the path and any path moved from it
+		/// </summary>
+		Path(std::string_view value, std::pmr::memory_resource* resource) :
+			_value(value, resource),
 			_rootEndLocation(),
+			_directoryCount(NoComponentIndex),
+			_directoryEnds(),
 			_fileNameStartLocation()
 		{
 			LoadDirect();
 		}
 
+		/// <summary>
+		/// Promote a view into an owning path, reusing the already validated locations
+		/// </summary>
+		explicit Path(PathView value) :
+			_value(value._value),
+			_rootEndLocation(value._rootEndLocation),
+			_directoryCount(NoComponentIndex),
+			_directoryEnds(),
+			_fileNameStartLocation(value._fileNameStartLocation)
+		{
+		}
+
+		/// <summary>
+		/// Gets the memory resource used for storage that does not fit inline, null when using the global heap
+		/// </summary>
+		std::pmr::memory_resource* GetMemoryResource() const noexcept
+		{
+			return _value.GetMemoryResource();
+		}
+
+		/// <summary>
+		/// Get a non-owning view of the path
+		/// Note: The view is only valid as long as this path is not modified or destroyed
+		/// </summary>
+		PathView ToView() const noexcept
+		{
+			return PathView(_value.ToStringView(), _rootEndLocation, _fileNameStartLocation);
+		}
+
 		/// <summary>
 		/// Gets a value indicating whether the path is empty
 		/// </summary>
 		bool IsEmpty() const
 		{
-			return _value == "./";
+			return _value.ToStringView() == "./";
 		}
 
 		/// <summary>
@@ -115,10 +219,15 @@ namespace Opal
 		/// </summary>
 		std::string_view GetRoot() const
 		{
-			if (!HasRoot())
-				throw std::runtime_error("Cannot access root on path that has none");
+			return ToView().GetRoot();
+		}
 
-			return std::string_view(_value.data(), _rootEndLocation);
+		/// <summary>
+		/// Gets the path root without throwing, returns false when the path has none
+		/// </summary>
+		bool TryGetRoot(std::string_view& root) const noexcept
+		{
+			return ToView().TryGetRoot(root);
 		}
 
 		/// <summary>
@@ -126,55 +235,94 @@ namespace Opal
 		/// </summary>
 		Path GetParent() const
 		{
-			auto result = Path();
+			auto result = Path(_value.GetMemoryResource());
 
 			// Take the root from the left hand side
 			result._rootEndLocation = _rootEndLocation;
 
 			// If there is a filename then return the directory
 			// Otherwise return one less directory
+			// Note: The component index is passed along whenever the parent is a prefix of the value
+			auto value = _value.ToStringView();
 			if (HasFileName())
 			{
 				// Pass along the path minus the filename
-				result._value = _value.substr(0, _fileNameStartLocation);
-				result._fileNameStartLocation = result._value.size();
+				result._value.Assign(value.substr(0, _fileNameStartLocation));
+				result.CopyComponentIndex(*this, _directoryCount);
+			}
+			else if (!HasComponentIndex() && FindEmptyDirectory() != std::string_view::npos)
+			{
+				// Drop the empty directories from a value that was not parsed before walking up,
+				// the same as rebuilding the parent from the directory components
+				result._value.Assign(value);
+				result._fileNameStartLocation = _fileNameStartLocation;
+				result.RemoveEmptyDirectories();
+				return result.GetParent();
 			}
 			else
 			{
-				// Pull apart the directories and remove the last one
-				// TODO: This can be done in place and then a substring returned for perf gains
-				auto directories = DecomposeDirectoriesString(GetDirectories());
-				if (directories.empty())
+				// Take the last directory from the component index when it has been built, which never holds
+				// empty directories, otherwise find it in place
+				auto lastDirectory = std::string_view();
+				bool hasDirectory = false;
+				bool isOnlyDirectory = false;
+				if (HasComponentIndex())
+				{
+					hasDirectory = _directoryCount > 0;
+					isOnlyDirectory = _directoryCount == 1;
+					if (hasDirectory)
+					{
+						size_t start = _directoryCount > 1 ?
+							_directoryEnds[_directoryCount - 2] + 1 :
+							(HasRoot() ? _rootEndLocation + 1 : 0);
+						lastDirectory = value.substr(start, _directoryEnds[_directoryCount - 1] - start);
+					}
+				}
+				else
+				{
+					auto directories = GetDirectoryComponents();
+					hasDirectory = !directories.empty();
+					if (hasDirectory)
+					{
+						auto last = directories.end();
+						--last;
+						lastDirectory = *last;
+						isOnlyDirectory = last == directories.begin();
+					}
+				}
+
+				if (!hasDirectory)
 				{
 					// No-op when at the root
+					result._value.Assign(value);
+					result.CopyComponentIndex(*this, _directoryCount);
 				}
-				else if (directories.size() == 1 && directories[0] == RelativeDirectory)
+				else if (isOnlyDirectory && lastDirectory == RelativeDirectory)
 				{
 					// If this is only a relative folder symbol then replace with the parent symbol
-					directories[0] = RelativeParentDirectory;
+					auto lastDirectoryStart = lastDirectory.data() - value.data();
+					auto buffer = result._value.Reset(lastDirectoryStart + 3);
+					std::memcpy(buffer, value.data(), lastDirectoryStart);
+					std::memcpy(buffer + lastDirectoryStart, "../", 3);
 				}
-				else if (directories.back() == RelativeParentDirectory)
+				else if (lastDirectory == RelativeParentDirectory)
 				{
 					// If this is entirely parent directories then add one more
-					directories.push_back(RelativeParentDirectory);
+					auto buffer = result._value.Reset(value.size() + 3);
+					std::memcpy(buffer, value.data(), value.size());
+					std::memcpy(buffer + value.size(), "../", 3);
 				}
 				else
 				{
 					// Otherwise pop off the top level folder
-					directories.pop_back();
+					auto lastDirectoryStart = lastDirectory.data() - value.data();
+					result._value.Assign(value.substr(0, lastDirectoryStart));
+					result.CopyComponentIndex(*this, _directoryCount - 1);
 				}
-
-				std::optional<std::string_view> root;
-				if (HasRoot())
-					root = GetRoot();
-
-				// Set the state of the result path
-				result.SetState(
-					directories,
-					root,
-					std::nullopt);
 			}
 
+			result._fileNameStartLocation = result._value.GetSize();
+
 			return result;
 		}
 
@@ -183,7 +331,7 @@ namespace Opal
 		/// </summary>
 		bool HasFileName() const
 		{
-			return _fileNameStartLocation < _value.size();
+			return ToView().HasFileName();
 		}
 
 		/// <summary>
@@ -191,13 +339,15 @@ namespace Opal
 		/// </summary>
 		const std::string_view GetFileName() const
 		{
-			if (!HasFileName())
-				throw std::runtime_error("Cannot access file name on path that has none");
+			return ToView().GetFileName();
+		}
 
-			// Use the start location to return the end of the value that is the filename
-			return std::string_view(
-				_value.data() + _fileNameStartLocation,
-				_value.size() - _fileNameStartLocation);
+		/// <summary>
+		/// Gets the file name without throwing, returns false when the path has none
+		/// </summary>
+		bool TryGetFileName(std::string_view& fileName) const noexcept
+		{
+			return ToView().TryGetFileName(fileName);
 		}
 
 		/// <summary>
@@ -205,7 +355,7 @@ namespace Opal
 		/// </summary>
 		bool HasFileStem() const
 		{
-			return HasFileName() && !GetFileStem().empty();
+			return ToView().HasFileStem();
 		}
 
 		/// <summary>
@@ -213,18 +363,7 @@ namespace Opal
 		/// </summary>
 		const std::string_view GetFileStem() const
 		{
-			// Everything before the last period is the stem
-			auto fileName = GetFileName();
-			auto lastSeparator = fileName.find_last_of(FileExtensionSeparator);
-			if (lastSeparator != std::string::npos)
-			{
-				return fileName.substr(0, lastSeparator);
-			}
-			else
-			{
-				// Return the entire filename if no extension
-				return fileName;
-			}
+			return ToView().GetFileStem();
 		}
 
 		/// <summary>
@@ -232,7 +371,7 @@ namespace Opal
 		/// </summary>
 		bool HasFileExtension() const
 		{
-			return HasFileName() && !GetFileExtension().empty();
+			return ToView().HasFileExtension();
 		}
 
 		/// <summary>
@@ -240,18 +379,7 @@ namespace Opal
 		/// </summary>
 		const std::string_view GetFileExtension() const
 		{
-			// Everything after and including the last period is the extension
-			auto fileName = GetFileName();
-			auto lastSeparator = fileName.find_last_of(FileExtensionSeparator);
-			if (lastSeparator != std::string::npos)
-			{
-				return fileName.substr(lastSeparator);
-			}
-			else
-			{
-				// Return the empty string
-				return "";
-			}
+			return ToView().GetFileExtension();
 		}
 
 		/// <summary>
@@ -259,14 +387,17 @@ namespace Opal
 		/// </summary>
 		void SetFilename(std::string_view value)
 		{
-			// Build the new final string
-			std::optional<std::string_view> root;
-			if (HasRoot())
-				root = GetRoot();
-			SetState(
-				DecomposeDirectoriesString(GetDirectories()),
-				root,
-				value);
+			// The value may reference the current file name, which is overwritten or released when resizing
+			if (IsInValue(value))
+			{
+				SetFilename(std::string(value));
+				return;
+			}
+
+			// Replace the file name in place, keeping the non empty directories
+			RemoveEmptyDirectories();
+			auto buffer = _value.Resize(_fileNameStartLocation + value.size());
+			std::memcpy(buffer + _fileNameStartLocation, value.data(), value.size());
 		}
 
 		/// <summary>
@@ -274,23 +405,33 @@ namespace Opal
 		/// </summary>
 		void SetFileExtension(std::string_view value)
 		{
-			// Build up the new filename and set the active state
-			std::stringstream stringBuilder;
-			stringBuilder << GetFileStem() << FileExtensionSeparator << value;
-			SetFilename(stringBuilder.str());
+			if (IsInValue(value))
+			{
+				SetFileExtension(std::string(value));
+				return;
+			}
+
+			// Replace everything after the stem with the new extension in place
+			RemoveEmptyDirectories();
+			auto stemEnd = _fileNameStartLocation + GetFileStem().size();
+			auto buffer = _value.Resize(stemEnd + 1 + value.size());
+			buffer[stemEnd] = FileExtensionSeparator;
+			std::memcpy(buffer + stemEnd + 1, value.data(), value.size());
 		}
 
 		/// <summary>
 		/// Get a path relative to the provided base
 		/// </summary>
-		Path GetRelativeTo(const Path& base)
+		Path GetRelativeTo(const Path& base) const
 		{
 			// If the root does not match then there is no way to get a relative path
 			// simply return a copy of this path
 			if ((base.HasRoot() && HasRoot() && base.GetRoot() != this->GetRoot()) ||
 				(base.HasRoot() ^ this->HasRoot()))
 			{
-				return *this;
+				auto result = Path(_value.GetMemoryResource());
+				result = *this;
+				return result;
 			}
 
 			// Force the base filenames as directories
@@ -300,54 +441,203 @@ namespace Opal
 			}
 
 			// Determine how many of the directories match
-			auto baseDirectories = DecomposeDirectoriesString(base.GetDirectories());
-			auto directories = DecomposeDirectoriesString(GetDirectories());
-			auto minDirectories = std::min(baseDirectories.size(), directories.size());
-			size_t countMatching = 0;
-			for (auto i = 0u; i < minDirectories; i++)
+			auto baseDirectories = base.GetDirectoryComponents();
+			auto directories = GetDirectoryComponents();
+			auto baseDirectory = baseDirectories.begin();
+			auto directory = directories.begin();
+			while (baseDirectory != baseDirectories.end() &&
+				directory != directories.end() &&
+				*baseDirectory == *directory)
 			{
-				if (baseDirectories[i] != directories[i])
-				{
-					break;
-				}
-
-				countMatching++;
+				++baseDirectory;
+				++directory;
 			}
 
 			// Add in up directories for any not matching in the base
-			auto resultDirectories = std::vector<std::string_view>();
-			if (countMatching == baseDirectories.size())
+			size_t parentDirectoryCount = 0;
+			for (; baseDirectory != baseDirectories.end(); ++baseDirectory)
+				parentDirectoryCount++;
+
+			// Note: The remaining directories and file name can be no longer than the current value
+			auto result = Path(_value.GetMemoryResource());
+			auto buffer = result._value.Reset(std::max<size_t>(2, 3 * parentDirectoryCount) + _value.GetSize());
+			size_t size = 0;
+			if (parentDirectoryCount == 0)
 			{
 				// Start with a single relative directory when no up directories required
-				resultDirectories.push_back(RelativeDirectory);
+				std::memcpy(buffer, "./", 2);
+				size = 2;
 			}
 			else
 			{
-				for (auto i = countMatching; i < baseDirectories.size(); i++)
+				for (auto i = 0u; i < parentDirectoryCount; i++)
 				{
-					resultDirectories.push_back(RelativeParentDirectory);
+					std::memcpy(buffer + size, "../", 3);
+					size += 3;
 				}
 			}
 
 			// Copy over the remaining entities from the target path
-			for (auto i = countMatching; i < directories.size(); i++)
+			for (; directory != directories.end(); ++directory)
 			{
-				resultDirectories.push_back(directories[i]);
+				auto remainingDirectory = *directory;
+				std::memcpy(buffer + size, remainingDirectory.data(), remainingDirectory.size());
+				size += remainingDirectory.size();
+				buffer[size++] = DirectorySeparator;
 			}
 
 			// Set the result path with no root
-			auto result = Path();
-			result.SetState(
-				resultDirectories,
-				std::nullopt,
-				GetFileName());
+			auto fileNameSize = _value.GetSize() - _fileNameStartLocation;
+			std::memcpy(buffer + size, _value.GetData() + _fileNameStartLocation, fileNameSize);
+			size += fileNameSize;
+
+			result._value.Truncate(size);
+			result._rootEndLocation = -1;
+			result._fileNameStartLocation = size - fileNameSize;
 
 			return result;
 		}
 
+		/// <summary>
+		/// Get a lazy range over the root, directories and file name of the path
+		/// </summary>
+		PathComponentRange GetComponents() const
+		{
+			return ToView().GetComponents();
+		}
+
+		/// <summary>
+		/// Build the component index that allows GetDepth, GetComponent, CommonPrefixLength and GetParent
+		/// to find the directories without scanning the value. The index is stored inline, so paths that are
+		/// deeper than the index capacity or whose directories end past the first 256 characters are not
+		/// indexed and continue to scan. The index is kept when changing the file name and passed on to the
+		/// parent directory, so walking up the parent chain of an indexed path never scans.
+		/// </summary>
+		void BuildComponentIndex() noexcept
+		{
+			_directoryCount = NoComponentIndex;
+			if (_fileNameStartLocation > std::numeric_limits<uint8_t>::max() + 1u)
+				return;
+
+			auto value = _value.ToStringView();
+			size_t directoryStart = HasRoot() ? _rootEndLocation + 1 : 0;
+			uint8_t count = 0;
+			for (auto location = directoryStart; location < _fileNameStartLocation; location++)
+			{
+				if (value[location] == DirectorySeparator)
+				{
+					// Leave values with empty directories (double separator) to the scanning fallback
+					if (location == directoryStart || count == ComponentIndexCapacity)
+						return;
+
+					_directoryEnds[count++] = static_cast<uint8_t>(location);
+					directoryStart = location + 1;
+				}
+			}
+
+			_directoryCount = count;
+		}
+
+		/// <summary>
+		/// Gets a value indicating whether the component index has been built for the current value
+		/// </summary>
+		bool HasComponentIndex() const noexcept
+		{
+			return _directoryCount != NoComponentIndex;
+		}
+
+		/// <summary>
+		/// Gets the number of directories in the path
+		/// </summary>
+		size_t GetDepth() const
+		{
+			if (HasComponentIndex())
+				return _directoryCount;
+
+			auto directories = GetDirectoryComponents();
+			return static_cast<size_t>(std::distance(directories.begin(), directories.end()));
+		}
+
+		/// <summary>
+		/// Gets the component at the index in the order of <see cref="GetComponents"/>, the root followed
+		/// by the directories and the file name
+		/// </summary>
+		std::string_view GetComponent(size_t index) const
+		{
+			if (HasRoot())
+			{
+				if (index == 0)
+					return GetRoot();
+				index--;
+			}
+
+			if (HasComponentIndex())
+			{
+				if (index < _directoryCount)
+				{
+					size_t start = index > 0 ? _directoryEnds[index - 1] + 1 : (HasRoot() ? _rootEndLocation + 1 : 0);
+					return _value.ToStringView().substr(start, _directoryEnds[index] - start);
+				}
+
+				index -= _directoryCount;
+			}
+			else
+			{
+				for (auto directory : GetDirectoryComponents())
+				{
+					if (index == 0)
+						return directory;
+					index--;
+				}
+			}
+
+			if (index == 0 && HasFileName())
+				return GetFileName();
+
+			throw std::runtime_error("Component index is past the end of the path");
+		}
+
+		/// <summary>
+		/// Gets the number of leading root and directory components shared with the other path
+		/// Note: File names are not compared since they cannot be a common parent
+		/// </summary>
+		size_t CommonPrefixLength(const Path& other) const
+		{
+			if (HasRoot() != other.HasRoot() || (HasRoot() && GetRoot() != other.GetRoot()))
+				return 0;
+
+			size_t count = HasRoot() ? 1 : 0;
+			if (HasComponentIndex() && other.HasComponentIndex())
+			{
+				// Both values match up to the first mismatch, so every directory that ends before it
+				// ends with the same separator in the other path
+				auto mismatch = PathScan::FindMismatch(_value.ToStringView(), other._value.ToStringView());
+				auto directoryEnds = std::span<const uint8_t>(_directoryEnds.data(), _directoryCount);
+				count += static_cast<size_t>(
+					std::lower_bound(directoryEnds.begin(), directoryEnds.end(), mismatch) - directoryEnds.begin());
+			}
+			else
+			{
+				auto directories = GetDirectoryComponents();
+				auto otherDirectories = other.GetDirectoryComponents();
+				auto current = std::mismatch(
+					directories.begin(),
+					directories.end(),
+					otherDirectories.begin(),
+					otherDirectories.end()).first;
+				count += static_cast<size_t>(std::distance(directories.begin(), current));
+			}
+
+			return count;
+		}
+
 		std::vector<std::string_view> DecomposeDirectories() const
 		{
-			return DecomposeDirectoriesString(GetDirectories());
+			auto result = std::vector<std::string_view>();
+			for (auto directory : GetDirectoryComponents())
+				result.push_back(directory);
+
+			return result;
 		}
 
 		/// <summary>
@@ -355,18 +645,34 @@ namespace Opal
 		/// </summary>
 		bool operator ==(const Path& rhs) const
 		{
-			return _value == rhs._value;
+			return _value.ToStringView() == rhs._value.ToStringView();
 		}
 
 		bool operator !=(const Path& rhs) const
 		{
-			return _value != rhs._value;
+			return _value.ToStringView() != rhs._value.ToStringView();
 		}
 
 		bool operator <(const Path& rhs) const
 		{
 			// TODO: Tests and better implementation
-			return _value < rhs._value;
+			return _value.ToStringView() < rhs._value.ToStringView();
+		}
+
+		/// <summary>
+		/// Gets a hash of the path value
+		/// Note: The hash is calculated on first use and cached until the path is modified
+		/// </summary>
+		size_t GetHash() const noexcept
+		{
+			auto hash = _value.GetCachedHash();
+			if (hash == 0)
+			{
+				hash = PathView::ComputeHash(_value.ToStringView());
+				_value.SetCachedHash(hash);
+			}
+
+			return hash;
 		}
 
 		/// <summary>
@@ -386,41 +692,48 @@ namespace Opal
 					std::format("Cannot combine a rooted path on the right hand side: {}", rhs.ToString()));
 			}
 
-			if (!rhs._value.starts_with(".."))
+			auto rhsValue = rhs._value.ToStringView();
+			if (!rhsValue.starts_with(".."))
 			{
 				// Simple relative directory can use fast string concatenation
-				auto combineValue = std::string(_value);
-				combineValue.append(rhs._value, 2);
-				auto result = Path(std::move(combineValue));
+				// directly into the result storage, skipping the leading "./" on the right hand side
+				auto lhsValue = _value.ToStringView();
+				auto result = Path(_value.GetMemoryResource());
+				auto buffer = result._value.Reset(lhsValue.size() + rhsValue.size() - 2);
+				std::memcpy(buffer, lhsValue.data(), lhsValue.size());
+				std::memcpy(buffer + lhsValue.size(), rhsValue.data() + 2, rhsValue.size() - 2);
+
+				// The root is unchanged and the file name is shifted by the left hand side
+				result._rootEndLocation = _rootEndLocation;
+				result._fileNameStartLocation = lhsValue.size() + rhs._fileNameStartLocation - 2;
 				return result;
 			}
 			else
 			{
 				// Combine the directories to resolve up directory references
-				auto resultDirectories = DecomposeDirectoriesString(GetDirectories());
-
-				auto rhsDirectories = DecomposeDirectoriesString(rhs.GetDirectories());
-				resultDirectories.insert(
-					resultDirectories.end(),
-					rhsDirectories.begin(),
-					rhsDirectories.end());
-
-				NormalizeDirectories(resultDirectories, HasRoot());
-
-				// Set the state with the root from the LHS and the filename from the RHS
-				auto result = Path();
-				std::optional<std::string_view> root;
-				if (HasRoot())
-					root = GetRoot();
-
-				std::string_view fileName;
-				if (rhs.HasFileName())
-					fileName = rhs.GetFileName();
-
-				result.SetState(
-					resultDirectories,
-					root,
-					fileName);
+				// Note: Normalizing can only shrink the combined value, so the combined size is an upper bound
+				auto result = Path(_value.GetMemoryResource());
+				auto lhsValue = _value.ToStringView();
+				auto buffer = result._value.Reset(lhsValue.size() + rhsValue.size());
+
+				// Copy the left hand side and the right hand side directories then resolve them in place
+				std::memcpy(buffer, lhsValue.data(), lhsValue.size());
+				std::memcpy(buffer + lhsValue.size(), rhsValue.data(), rhs._fileNameStartLocation);
+				size_t directoriesStart = HasRoot() ? _rootEndLocation + 1 : 0;
+				auto size = NormalizeDirectoriesInPlace(
+					buffer,
+					directoriesStart,
+					lhsValue.size() + rhs._fileNameStartLocation,
+					HasRoot());
+
+				// Take the filename from the right hand side
+				auto fileNameSize = rhsValue.size() - rhs._fileNameStartLocation;
+				std::memcpy(buffer + size, rhsValue.data() + rhs._fileNameStartLocation, fileNameSize);
+				size += fileNameSize;
+
+				result._value.Truncate(size);
+				result._rootEndLocation = _rootEndLocation;
+				result._fileNameStartLocation = size - fileNameSize;
 
 				return result;
 			}
@@ -429,309 +742,306 @@ namespace Opal
 		/// <summary>
 		/// Convert to string
 		/// </summary>
-		const std::string& ToString() const
+		std::string ToString() const
+		{
+			return std::string(_value.ToStringView());
+		}
+
+		/// <summary>
+		/// Get a view of the string value without copying
+		/// Note: The view is guaranteed to be null terminated
+		/// </summary>
+		std::string_view ToStringView() const
 		{
-			return _value;
+			return _value.ToStringView();
 		}
 
 		std::string ToAlternateString() const
 		{
 			// Replace all normal separators with the windows version
-			auto result = _value;
-			std::replace(result.begin(), result.end(), DirectorySeparator, AlternateDirectorySeparator);
+			auto result = ToString();
+			PathScan::Replace(result.data(), result.size(), result.data(), DirectorySeparator, AlternateDirectorySeparator);
 			return result;
 		}
 
 	private:
 		/// <summary>
-		/// Helper that loads a string directly into the path value
+		/// Gets a value indicating whether the value references the characters of this path
 		/// </summary>
-		void LoadDirect()
+		bool IsInValue(std::string_view value) const noexcept
 		{
-			#ifdef _DEBUG
-			auto firstAlternateDirectory = _value.find_first_of(AlternateDirectorySeparator);
-			if (firstAlternateDirectory != std::string::npos)
-				throw std::runtime_error("Debug check for windows ridiculous directory separator");
-			#endif
+			auto current = _value.ToStringView();
+			return std::less_equal<const char*>()(current.data(), value.data()) &&
+				std::less_equal<const char*>()(value.data(), current.data() + current.size());
+		}
 
-			auto firstSeparator = _value.find_first_of(DirectorySeparator);
-			if (firstSeparator == std::string::npos)
-			{
-				throw std::runtime_error("A path must have a directory separator");
-			}
+		/// <summary>
+		/// Find the first empty directory (double separator) in a value that was loaded without parsing
+		/// </summary>
+		size_t FindEmptyDirectory() const noexcept
+		{
+			// Include the root separator so a directory region that starts with a separator is found
+			auto directories = _value.ToStringView().substr(0, _fileNameStartLocation);
+			return directories.find("//", HasRoot() ? _rootEndLocation : 0);
+		}
 
-			auto root = std::string_view(_value.c_str(), firstSeparator);
-			if (IsRoot(root))
-			{
-				// Absolute path
-				_rootEndLocation = (int)firstSeparator;
-			}
-			else if (root == RelativeDirectory || root == RelativeParentDirectory)
-			{
-				// Relative path
-				_rootEndLocation = -1;
-			}
-			else
+		/// <summary>
+		/// Remove the empty directories in place, keeping the root and file name
+		/// </summary>
+		void RemoveEmptyDirectories()
+		{
+			auto emptyDirectory = FindEmptyDirectory();
+			if (emptyDirectory == std::string_view::npos)
+				return;
+
+			auto size = _value.GetSize();
+			auto buffer = _value.Resize(size);
+			auto write = emptyDirectory + 1;
+			for (auto read = write + 1; read < size; read++)
 			{
-				throw std::runtime_error(std::format("Unknown directory root {}", root));
-			}
+				if (read < _fileNameStartLocation && buffer[read] == DirectorySeparator && buffer[write - 1] == DirectorySeparator)
+					continue;
 
-			// Check if has file name
-			auto lastSeparator = _value.find_last_of(DirectorySeparator);
-			if (lastSeparator != std::string::npos && lastSeparator != _value.size() - 1)
-			{
-				_fileNameStartLocation = lastSeparator + 1;
+				buffer[write++] = buffer[read];
 			}
-			else
+
+			_fileNameStartLocation -= size - write;
+			_directoryCount = NoComponentIndex;
+			_value.Truncate(write);
+		}
+
+		/// <summary>
+		/// Take the first directories from the component index of the source when it has been built
+		/// </summary>
+		void CopyComponentIndex(const Path& source, uint8_t count) noexcept
+		{
+			if (source.HasComponentIndex())
 			{
-				_fileNameStartLocation = _value.size();
+				_directoryCount = count;
+				std::copy_n(source._directoryEnds.begin(), count, _directoryEnds.begin());
 			}
 		}
 
-		void ParsePath(std::string_view value)
+		/// <summary>
+		/// Initialize an empty path that allocates from the provided memory resource
+		/// </summary>
+		explicit Path(std::pmr::memory_resource* resource) :
+			_value("./", resource),
+			_rootEndLocation(-1),
+			_directoryCount(NoComponentIndex),
+			_directoryEnds(),
+			_fileNameStartLocation(2)
 		{
-			// Break out the individual components of the path
-			std::vector<std::string_view> directories;
-			std::optional<std::string_view> root;
-			std::optional<std::string_view> fileName;
-			DecomposeRawPathString(
-				value,
-				directories,
-				root,
-				fileName);
-
-			// Normalize any unnecessary directories in the raw path
-			bool hasRoot = root.has_value();
-			NormalizeDirectories(directories, hasRoot);
-
-			// Rebuild the string value
-			SetState(
-				directories,
-				root,
-				fileName);
-		}
-
-		void DecomposeRawPathString(
-			std::string_view value,
-			std::vector<std::string_view>& directories,
-			std::optional<std::string_view>& root,
-			std::optional<std::string_view>& fileName)
-		{
-			size_t current = 0;
-			size_t next = 0;
-			bool isFirst = true;
-			while ((next = value.find_first_of(AllValidDirectorySeparators, current)) != std::string::npos)
-			{
-				auto directory = value.substr(current, next - current);
-
-				// Check if the first entry is a root
-				if (isFirst)
-				{
-					if (IsRoot(directory))
-					{
-						root = directory;
-					}
-					else
-					{
-						// Ensure that the unrooted path starts with a relative symbol
-						if (!IsRelativeDirectory(directory))
-						{
-							directories.push_back(RelativeDirectory);
-						}
-
-						directories.push_back(directory);
-					}
+		}
 
-					isFirst = false;
-				}
-				else
-				{
-					directories.push_back(directory);
-				}
+		/// <summary>
+		/// Helper that loads a string directly into the path value
+		/// </summary>
+		void LoadDirect()
+		{
+			// Share the validation with the view over the newly stored value
+			auto view = PathView(_value.ToStringView());
+			_rootEndLocation = view._rootEndLocation;
+			_fileNameStartLocation = view._fileNameStartLocation;
+		}
 
-				current = next + 1;
+		void ParsePath(std::string_view value)
+		{
+			// Check if the first entry is a root, which could be the empty linux root or a drive letter
+			auto firstSeparator = PathScan::FindFirst(value, 0, DirectorySeparator, AlternateDirectorySeparator);
+			auto firstDirectory = value.substr(0, firstSeparator);
+			bool hasRoot = !value.empty() && PathView::IsRoot(firstDirectory);
+
+			// Ensure that the unrooted path starts with a relative symbol and that a single relative
+			// directory ends with a separator
+			auto prefix = std::string_view();
+			auto rest = value;
+			bool appendSeparator = false;
+			if (hasRoot)
+			{
+				rest = firstSeparator == std::string_view::npos ? std::string_view() : value.substr(firstSeparator + 1);
 			}
-
-			// Check if there are characters beyond the last separator
-			if (current != value.size())
+			else if (!IsRelativeDirectory(firstDirectory))
 			{
-				auto directory = value.substr(current, next - current);
-
-				// Check if still on the first entry
-				// Could be empty root or single filename
-				if (isFirst)
-				{
-					if (IsRoot(directory))
-					{
-						root = directory;
-					}
-					else
-					{
-						// Ensure that the unrooted path starts with a relative symbol
-						if (!IsRelativeDirectory(directory))
-						{
-							directories.push_back(RelativeDirectory);
-							fileName = directory;
-						}
-						else
-						{
-							// Saw a single relative directory
-							directories.push_back(directory);
-						}
-					}
+				prefix = "./";
+			}
+			else if (firstSeparator == std::string_view::npos)
+			{
+				appendSeparator = true;
+			}
 
-					isFirst = false;
-				}
-				else
-				{
-					fileName = directory;
-				}
+			// Write the raw path straight into the storage with the normal separators
+			auto rootSize = hasRoot ? firstDirectory.size() + 1 : prefix.size();
+			auto size = rootSize + rest.size() + (appendSeparator ? 1 : 0);
+			auto buffer = _value.Reset(size);
+			if (hasRoot)
+			{
+				std::memcpy(buffer, firstDirectory.data(), firstDirectory.size());
+				buffer[firstDirectory.size()] = DirectorySeparator;
+			}
+			else if (!prefix.empty())
+			{
+				std::memcpy(buffer, prefix.data(), prefix.size());
 			}
 
-			// If we saw nothing then add a single relative directory
-			if (isFirst)
+			PathScan::Replace(rest.data(), rest.size(), buffer + rootSize, AlternateDirectorySeparator, DirectorySeparator);
+			if (appendSeparator)
+				buffer[size - 1] = DirectorySeparator;
+
+			// Normalize any unnecessary directories in the raw path and move the file name after them
+			// Note: Every unrooted path has a separator from the relative prefix, so there is always a last separator
+			size_t directoriesStart = hasRoot ? rootSize : 0;
+			auto directoriesEnd = std::string_view(buffer, size).rfind(DirectorySeparator) + 1;
+			auto normalizedEnd = NormalizeDirectoriesInPlace(buffer, directoriesStart, directoriesEnd, hasRoot);
+			auto fileNameSize = size - directoriesEnd;
+			if (normalizedEnd != directoriesEnd)
 			{
-				directories.push_back(RelativeDirectory);
+				std::memmove(buffer + normalizedEnd, buffer + directoriesEnd, fileNameSize);
+				_value.Truncate(normalizedEnd + fileNameSize);
 			}
+
+			// Store the persistent state
+			_rootEndLocation = hasRoot ? static_cast<int>(firstDirectory.size()) : -1;
+			_fileNameStartLocation = normalizedEnd;
 		}
 
-		bool IsRelativeDirectory(const std::string_view directory)
+		static bool IsRelativeDirectory(const std::string_view directory)
 		{
 			return directory == RelativeDirectory || directory == RelativeParentDirectory;
 		}
 
-		std::vector<std::string_view> DecomposeDirectoriesString(std::string_view value) const
+		/// <summary>
+		/// Find the next directory start at or after the provided directory start location that could
+		/// need to be resolved, which is any directory that is empty or starts with a period.
+		/// Checks eight characters at a time to skip over the runs of normal directories.
+		/// </summary>
+		static size_t FindNextSpecialDirectory(
+			const char* buffer,
+			size_t location,
+			size_t end)
 		{
-			size_t current = 0;
-			size_t next = 0;
-			auto directories = std::vector<std::string_view>();
-			while ((next = value.find_first_of(DirectorySeparator, current)) != std::string::npos)
+			if (location == end || buffer[location] == FileExtensionSeparator || buffer[location] == DirectorySeparator)
+				return location;
+
+			location++;
+			if constexpr (std::endian::native == std::endian::little)
 			{
-				auto directory = value.substr(current, next - current);
-				if (!directory.empty())
+				constexpr uint64_t ones = 0x0101010101010101;
+				constexpr uint64_t lowBits = 0x7F7F7F7F7F7F7F7F;
+				constexpr uint64_t highBits = 0x8080808080808080;
+				auto matchMask = [](uint64_t value, char match)
 				{
-					directories.push_back(directory);
-				}
-
-				current = next + 1;
-			}
+					auto difference = value ^ (ones * static_cast<uint8_t>(match));
+					return ~(((difference & lowBits) + lowBits) | difference) & highBits;
+				};
 
-			// Ensure the last separator was at the end of the string
-			if (current != value.size())
-			{
-				throw std::runtime_error("The directories string must end in a separator");
+				for (; location + sizeof(uint64_t) <= end; location += sizeof(uint64_t))
+				{
+					uint64_t previous;
+					uint64_t current;
+					std::memcpy(&previous, buffer + location - 1, sizeof(uint64_t));
+					std::memcpy(&current, buffer + location, sizeof(uint64_t));
+					auto mask = matchMask(previous, DirectorySeparator) &
+						(matchMask(current, FileExtensionSeparator) | matchMask(current, DirectorySeparator));
+					if (mask != 0)
+						return location + (std::countr_zero(mask) / 8);
+				}
 			}
 
-			return directories;
-		}
-
-		bool IsRoot(std::string_view value)
-		{
-			if (value.size() == 0)
+			for (; location < end; location++)
 			{
-				// Linux root
-				return true;
-			}
-			else if (value.size() == 2)
-			{
-				// Check for drive letter
-				if (std::isalpha(value[0]) && value[1] == LetterDriveSpecifier)
+				if (buffer[location - 1] == DirectorySeparator &&
+					(buffer[location] == FileExtensionSeparator || buffer[location] == DirectorySeparator))
 				{
-					return true;
+					return location;
 				}
 			}
 
-			return false;
+			return end;
 		}
 
 		/// <summary>
-		/// Resolve any up directory tokens or empty (double separator) directories that are inside a path
+		/// Resolve any up directory, current directory or empty (double separator) directories inside
+		/// a directories buffer in place with a single forward scan and return the new end location.
+		/// Runs of normal directories are only moved when an earlier directory was removed.
 		/// </summary>
-		void NormalizeDirectories(
-			std::vector<std::string_view>& directories,
-			bool hasRoot) const
+		static size_t NormalizeDirectoriesInPlace(
+			char* buffer,
+			size_t start,
+			size_t end,
+			bool hasRoot)
 		{
-			// Remove as many up directories as we can
-			for (size_t i = 0; i < directories.size(); i++)
+			auto write = start;
+			auto runStart = start;
+			size_t directoryStart;
+			for (auto read = start; (directoryStart = FindNextSpecialDirectory(buffer, read, end)) != end;)
 			{
+				auto directoryEnd = directoryStart;
+				while (buffer[directoryEnd] != DirectorySeparator)
+					directoryEnd++;
+				read = directoryEnd + 1;
+
+				auto length = directoryEnd - directoryStart;
+				bool isRelative = length == 1;
+				bool isParent = length == 2 && buffer[directoryStart + 1] == '.';
+				if (length != 0 && !isRelative && !isParent)
+					continue;
+
+				// Move the pending run of normal directories into place
+				if (write != runStart)
+					std::memmove(buffer + write, buffer + runStart, directoryStart - runStart);
+				write += directoryStart - runStart;
+				runStart = read;
+
 				// Remove empty directories (double separator) or relative directories if rooted or not at start
-				if (directories.at(i).empty() ||
-					((hasRoot || i != 0) && directories.at(i) == RelativeDirectory))
+				bool isFirst = write == start;
+				bool keep = true;
+				if (length == 0 || ((hasRoot || !isFirst) && isRelative))
 				{
-					directories.erase(
-						directories.begin() + (i),
-						directories.begin() + (i + 1));
-					i -= 1;
+					keep = false;
 				}
-				else
+				else if (isParent && !isFirst)
 				{
-					// Check if we can combine any parent directories
-					// Allow the first directory to remain a parent
-					if (i != 0)
+					// Remove a parent directory if possible, allowing the first directory to remain a parent
+					auto previousStart = write - 1;
+					while (previousStart > start && buffer[previousStart - 1] != DirectorySeparator)
+						previousStart--;
+					auto previous = std::string_view(buffer + previousStart, write - previousStart - 1);
+
+					if (previous == RelativeDirectory)
+					{
+						// If the previous is a relative then just replace it
+						write = previousStart;
+					}
+					else if (previous != RelativeParentDirectory)
 					{
-						// Remove a parent directory if possible
-						if (directories.at(i) == RelativeParentDirectory &&
-							directories.at(i - 1) != RelativeParentDirectory)
-						{
-							// If the previous is a relative then just replace it
-							if (directories.at(i - 1) == RelativeDirectory)
-							{
-								directories.erase(
-									directories.begin() + (i - 1),
-									directories.begin() + (i));
-								i -= 1;
-							}
-							else
-							{
-								// Remove the directories and move back
-								directories.erase(
-									directories.begin() + (i - 1),
-									directories.begin() + (i + 1));
-								i -= 2;
-							}
-						}
+						// Remove the previous directory and drop this one
+						write = previousStart;
+						keep = false;
 					}
 				}
+
+				if (keep)
+				{
+					std::memmove(buffer + write, buffer + directoryStart, length + 1);
+					write += length + 1;
+				}
 			}
+
+			// Move the final run of normal directories into place
+			if (write != runStart)
+				std::memmove(buffer + write, buffer + runStart, end - runStart);
+			write += end - runStart;
+
+			return write;
 		}
 
 		/// <summary>
-		/// Convert the components of the path into the string value
+		/// Get a lazy range over only the directories of the path
 		/// </summary>
-		void SetState(
-			const std::vector<std::string_view>& directories,
-			std::optional<std::string_view> root,
-			std::optional<std::string_view> fileName)
+		PathComponentRange GetDirectoryComponents() const
 		{
-			std::stringstream stringBuilder;
-
-			if (root.has_value())
-			{
-				stringBuilder << root.value() << DirectorySeparator;
-			}
-
-			for (size_t i = 0; i < directories.size(); i++)
-			{
-				stringBuilder << directories[i] << DirectorySeparator;
-			}
-
-			if (fileName.has_value())
-			{
-				stringBuilder << fileName.value();
-			}
-
-			// Store the persistent state
-			_value = stringBuilder.str();
-
-			if (root.has_value())
-				_rootEndLocation = (int)root.value().size();
-			else
-				_rootEndLocation = -1;
-
-			if (fileName.has_value())
-				_fileNameStartLocation = _value.size() - fileName.value().size();
-			else
-				_fileNameStartLocation = _value.size();
+			return PathComponentRange(GetDirectories(), -1, GetDirectories().size());
 		}
 
 		const std::string_view GetDirectories() const
@@ -739,15 +1049,24 @@ namespace Opal
 			if (_rootEndLocation > 0)
 			{
 				return std::string_view(
-					_value.data() + _rootEndLocation,
+					_value.GetData() + _rootEndLocation,
 					_fileNameStartLocation - _rootEndLocation);
 			}
 			else
 			{
 				return std::string_view(
-					_value.data(),
+					_value.GetData(),
 					_fileNameStartLocation);
 			}
 		}
 	};
 }
+
+template<>
+struct std::hash<Opal::Path>
+{
+	size_t operator()(const Opal::Path& value) const noexcept
+	{
+		return value.GetHash();
+	}
+};
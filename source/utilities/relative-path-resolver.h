@@ -0,0 +1,206 @@
+﻿// <copyright file="relative-path-resolver.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+#pragma once
+#include "path.h"
+
+namespace Opal
+{
+	/// <summary>
+	/// Computes paths relative to a single base directory
+	/// The base is split into directories once up front and each path is matched against it with a
+	/// single block compare of the directory strings, which produces the same results as
+	/// <see cref="Path::GetRelativeTo"/> for paths without empty directories.
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	class RelativePathResolver
+	{
+	private:
+		static constexpr char DirectorySeparator = '/';
+
+		/// <summary>
+		/// The layout of a single result, calculated before any characters are written
+		/// </summary>
+		struct Result
+		{
+			// The number of up directories, or NoBase when the path cannot be relative to the base
+			size_t ParentDirectoryCount;
+
+			// The part of the path copied after the up directories
+			std::string_view Remaining;
+			size_t FileNameSize;
+		};
+
+		static constexpr size_t NoBase = std::numeric_limits<size_t>::max();
+
+		Path _base;
+		std::string_view _directories;
+		std::vector<size_t> _directoryEnds;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref="RelativePathResolver"/> class.
+		/// </summary>
+		RelativePathResolver(Path base) :
+			_base(std::move(base)),
+			_directories(),
+			_directoryEnds()
+		{
+			// Force the base filenames as directories
+			if (_base.HasFileName())
+			{
+				throw std::runtime_error("Cannot combine a path that is a file as the base.");
+			}
+
+			// Note: The base owns its storage so the view is stable for the lifetime of the resolver
+			_directories = GetDirectories(_base.ToView());
+			for (size_t location = 0; location < _directories.size(); location++)
+			{
+				if (_directories[location] == DirectorySeparator)
+					_directoryEnds.push_back(location + 1);
+			}
+		}
+
+		const Path& GetBase() const noexcept
+		{
+			return _base;
+		}
+
+		/// <summary>
+		/// Get the path relative to the base
+		/// </summary>
+		Path Resolve(const Path& path) const
+		{
+			auto result = Calculate(path.ToView());
+			if (result.ParentDirectoryCount == NoBase)
+				return path;
+
+			// Build short values on the stack since the path copies them into its own storage
+			auto size = GetSize(result);
+			if (size < PathStorage::InlineCapacity)
+			{
+				std::array<char, PathStorage::InlineCapacity> buffer;
+				return Path(Write(result, buffer.data()));
+			}
+			else
+			{
+				auto buffer = std::string(size, '\0');
+				return Path(Write(result, buffer.data()));
+			}
+		}
+
+		/// <summary>
+		/// Get all of the paths relative to the base, writing the values contiguously into the buffer
+		/// The buffer and views are replaced, which allows reusing their capacity across calls.
+		/// Note: The views reference the buffer and are only valid until it is next modified
+		/// </summary>
+		void ResolveAll(std::span<const Path> paths, std::string& buffer, std::vector<PathView>& views) const
+		{
+			// Size the buffer once up front for the longest possible results and trim it at the end
+			// Note: A result can be no longer than the path plus an up directory for every base directory
+			auto maxParentSize = std::max<size_t>(2, 3 * _directoryEnds.size());
+			size_t maxSize = 0;
+			for (auto& path : paths)
+				maxSize += maxParentSize + path.ToStringView().size();
+
+			buffer.resize(maxSize);
+
+			views.clear();
+			views.reserve(paths.size());
+			size_t location = 0;
+			for (auto& path : paths)
+			{
+				auto value = path.ToView();
+				auto result = Calculate(value);
+				if (result.ParentDirectoryCount == NoBase)
+				{
+					// Copy over the unchanged path with its existing locations
+					std::memcpy(buffer.data() + location, value._value.data(), value._value.size());
+					views.push_back(PathView(
+						std::string_view(buffer.data() + location, value._value.size()),
+						value._rootEndLocation,
+						value._fileNameStartLocation));
+				}
+				else
+				{
+					views.push_back(Write(result, buffer.data() + location));
+				}
+
+				location += views.back()._value.size();
+			}
+
+			buffer.resize(location);
+		}
+
+	private:
+		/// <summary>
+		/// Gets the directories of the path, including the separator that follows the root
+		/// </summary>
+		static std::string_view GetDirectories(const PathView& path) noexcept
+		{
+			size_t start = path._rootEndLocation > 0 ? path._rootEndLocation : 0;
+			return path._value.substr(start, path._fileNameStartLocation - start);
+		}
+
+		Result Calculate(const PathView& path) const noexcept
+		{
+			// If the root does not match then there is no way to get a relative path
+			if ((_base.HasRoot() && path.HasRoot() && _base.GetRoot() != path.GetRoot()) ||
+				(_base.HasRoot() ^ path.HasRoot()))
+			{
+				return { NoBase, path._value, 0 };
+			}
+
+			// Every base directory that ends within the common prefix is shared
+			auto directories = GetDirectories(path);
+			auto commonSize = PathScan::FindMismatch(_directories, directories);
+			auto matchingEnd = std::upper_bound(_directoryEnds.begin(), _directoryEnds.end(), commonSize);
+			auto matchingCount = static_cast<size_t>(matchingEnd - _directoryEnds.begin());
+			auto remainingStart = matchingCount > 0 ? _directoryEnds[matchingCount - 1] : 0;
+
+			auto fileNameSize = path._value.size() - path._fileNameStartLocation;
+			return {
+				_directoryEnds.size() - matchingCount,
+				std::string_view(directories.data() + remainingStart, directories.size() - remainingStart + fileNameSize),
+				fileNameSize,
+			};
+		}
+
+		static size_t GetSize(const Result& result) noexcept
+		{
+			if (result.ParentDirectoryCount == NoBase)
+				return result.Remaining.size();
+			else
+				return std::max<size_t>(2, 3 * result.ParentDirectoryCount) + result.Remaining.size();
+		}
+
+		/// <summary>
+		/// Write the relative path into the buffer, which must have room for the calculated size
+		/// </summary>
+		static PathView Write(const Result& result, char* buffer) noexcept
+		{
+			size_t size = 0;
+			if (result.ParentDirectoryCount == 0)
+			{
+				// Start with a single relative directory when no up directories required
+				std::memcpy(buffer, "./", 2);
+				size = 2;
+			}
+			else
+			{
+				for (auto i = 0u; i < result.ParentDirectoryCount; i++)
+				{
+					std::memcpy(buffer + size, "../", 3);
+					size += 3;
+				}
+			}
+
+			std::memcpy(buffer + size, result.Remaining.data(), result.Remaining.size());
+			size += result.Remaining.size();
+
+			return PathView(std::string_view(buffer, size), -1, size - result.FileNameSize);
+		}
+	};
+}
@@ -14,6 +14,12 @@ namespace Opal
 	class SemanticVersion
 	{
 	public:
+		/// <summary>
+		/// The maximum number of characters written when formatting a version
+		/// Note: Three signed integers and the two separators
+		/// </summary>
+		static constexpr size_t MaxFormatSize = 3 * 11 + 2;
+
 		/// <summary>
 		/// Try parse the value
 		/// </summary>
@@ -214,47 +220,105 @@ namespace Opal
 		}
 
 		/// <summary>
-		/// Comparison operator
+		/// Comparison operator, ordered by major, then minor, then patch
 		/// </summary>
 		bool operator <(const SemanticVersion& rhs) const
 		{
-			return _major < rhs._major ||
-				GetMinorOrDefault() < rhs.GetMinorOrDefault() ||
-				GetPatchOrDefault() < rhs.GetPatchOrDefault();
+			if (_major != rhs._major)
+				return _major < rhs._major;
+			if (GetMinorOrDefault() != rhs.GetMinorOrDefault())
+				return GetMinorOrDefault() < rhs.GetMinorOrDefault();
+			return GetPatchOrDefault() < rhs.GetPatchOrDefault();
 		}
 		bool operator >(const SemanticVersion& rhs) const
 		{
-			return _major > rhs._major ||
-				GetMinorOrDefault() > rhs.GetMinorOrDefault() ||
-				GetPatchOrDefault() > rhs.GetPatchOrDefault();
+			return rhs < *this;
 		}
 
 		/// <summary>
 		/// Convert to string
 		/// </summary>
 		std::string ToString() const
+		{
+			std::array<char, MaxFormatSize> buffer;
+			auto end = FormatTo(buffer.data());
+			return std::string(buffer.data(), end);
+		}
+
+		/// <summary>
+		/// Write the version into a buffer that holds at least <see cref="MaxFormatSize"/> characters
+		/// Returns the location after the last character written.
+		/// </summary>
+		char* FormatTo(char* buffer) const noexcept
 		{
 			// "{Major}(.{Minor}(.{Patch}))"
-			auto result = std::to_string(_major);
+			auto result = FormatInteger(buffer, _major);
 			if (HasMinor())
 			{
-				result.append(".");
-				result.append(std::to_string(_minor.value()));
-				
+				*result++ = '.';
+				result = FormatInteger(result, _minor.value());
+
 				if (HasPatch())
 				{
-					result.append(".");
-					result.append(std::to_string(_patch.value()));
-					return result;
+					*result++ = '.';
+					result = FormatInteger(result, _patch.value());
 				}
 			}
 
 			return result;
 		}
 
+		/// <summary>
+		/// Write the version to an output iterator, such as a back inserter for an existing string
+		/// </summary>
+		template<typename TOutputIterator>
+		TOutputIterator FormatTo(TOutputIterator output) const
+		{
+			std::array<char, MaxFormatSize> buffer;
+			auto end = FormatTo(buffer.data());
+			return std::copy(buffer.data(), end, output);
+		}
+
 	private:
+		/// <summary>
+		/// Write a single value, with a shortcut for the single digits that make up most versions
+		/// </summary>
+		static char* FormatInteger(char* buffer, int value) noexcept
+		{
+			if (value >= 0 && value < 10)
+			{
+				*buffer = static_cast<char>('0' + value);
+				return buffer + 1;
+			}
+
+			return std::to_chars(buffer, buffer + MaxIntegerSize, value).ptr;
+		}
+
+		static constexpr size_t MaxIntegerSize = 11;
+
 		int _major;
 		std::optional<int> _minor;
 		std::optional<int> _patch;
 	};
 }
+
+/// <summary>
+/// Format a semantic version with std::format, writing straight into the output without a temporary string
+/// </summary>
+template<>
+struct std::formatter<Opal::SemanticVersion>
+{
+	constexpr auto parse(std::format_parse_context& context)
+	{
+		auto current = context.begin();
+		if (current != context.end() && *current != '}')
+			throw std::format_error("Semantic version does not support format specifiers");
+
+		return current;
+	}
+
+	auto format(const Opal::SemanticVersion& value, std::format_context& context) const
+	{
+		return value.FormatTo(context.out());
+	}
+};
@@ -4,110 +4,256 @@
 
 module;
 
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
 #include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
+#if defined(__x86_64__) || defined(_M_X64)
+#define OPAL_SEQUENCE_MAP_SSE2
+#include <emmintrin.h>
+#endif
+
+#include "hash-index.h"
+
 export module Opal:SequenceMap;
 
 namespace Opal
 {
+	/// <summary>
+	/// Keys that can be found through the standard hash
+	/// </summary>
+	template<class TKey>
+	concept SequenceMapHashable = requires(const TKey& key)
+	{
+		{ std::hash<TKey>()(key) } -> std::convertible_to<size_t>;
+	};
+
+	/// <summary>
+	/// Keys that can be compared against the key type without converting them first
+	/// </summary>
+	template<class TKey, class TLookup>
+	concept SequenceMapLookup = requires(const TKey& key, const TLookup& lookup)
+	{
+		{ key == lookup } -> std::convertible_to<bool>;
+	};
+
+	/// <summary>
+	/// The string view that string keys are hashed through, which is void for other keys
+	/// </summary>
+	template<class TKey>
+	struct SequenceMapKeyView
+	{
+		using Type = void;
+	};
+
+	template<class TChar, class TTraits, class TAllocator>
+	struct SequenceMapKeyView<std::basic_string<TChar, TTraits, TAllocator>>
+	{
+		using Type = std::basic_string_view<TChar, TTraits>;
+	};
+
 	/// <summary>
 	/// A special map that is mutated as a vector
+	/// Maps with hashable keys keep a one byte fingerprint of each key hash beside the entries, so small
+	/// maps find keys by scanning sixteen fingerprints at a time and only compare the keys that match.
+	/// Once the map holds more than the index threshold it also keeps an open addressing index from key
+	/// hashes to entry positions, so large maps find keys in constant time while still iterating in
+	/// insertion order.
+	/// Lookups accept any type that compares equal to the keys, so string keys can be found from a
+	/// string view or literal without a copy.
 	/// </summary>
-	export template<class TKey, class TValue>
+	export template<class TKey, class TValue, size_t IndexThreshold = 16>
 	class SequenceMap
 	{
 	private:
 		using raw_data = std::vector<std::pair<TKey, TValue>>;
+
+		static constexpr size_t NotFound = std::numeric_limits<size_t>::max();
+		static constexpr size_t FingerprintBlockSize = 16;
+
+		// Maps this small compare the keys directly since hashing the lookup costs more than the compares
+		static constexpr size_t FingerprintThreshold = 4;
+
 		raw_data _data;
 
+		// The high byte of each key hash in entry order, which is empty for keys without a hash
+		std::vector<uint8_t> _fingerprints;
+
+		HashIndex _index;
+
 	public:
 		/// <summary>
 		/// Initialize a new instance of the SequenceMap class
 		/// </summary>
 		SequenceMap() :
-			_data()
+			_data(),
+			_fingerprints(),
+			_index()
 		{
 		}
 
 		SequenceMap(SequenceMap&& other) :
-			_data(std::move(other._data))
+			_data(std::move(other._data)),
+			_fingerprints(std::move(other._fingerprints)),
+			_index(std::move(other._index))
 		{
+			other._data.clear();
+			other._fingerprints.clear();
+			other._index = HashIndex();
 		}
 
 		SequenceMap(const SequenceMap& other) :
-			_data(other._data)
+			_data(other._data),
+			_fingerprints(other._fingerprints),
+			_index(other._index)
 		{
 		}
 
 		SequenceMap(std::initializer_list<std::pair<TKey, TValue>> init) :
-			_data(init)
+			_data(init),
+			_fingerprints(),
+			_index()
 		{
+			if constexpr (SequenceMapHashable<TKey>)
+			{
+				_fingerprints.reserve(_data.size());
+				for (const auto& entry : _data)
+					_fingerprints.push_back(GetFingerprint(HashKey(entry.first)));
+			}
+
+			if (NeedsIndex())
+				RebuildIndex(2 * _data.size());
 		}
 
 		~SequenceMap()
 		{
 		}
 
-		bool Contains(const TKey& key) const
+		/// <summary>
+		/// Reserve space for the requested number of entries, including their index
+		/// </summary>
+		void Reserve(size_t capacity)
 		{
-			for (const auto& entry : _data)
+			_data.reserve(capacity);
+			if constexpr (SequenceMapHashable<TKey>)
 			{
-				if (entry.first == key)
-					return true;
+				_fingerprints.reserve(capacity);
+				if (capacity > IndexThreshold && _index.NeedsGrowth(capacity))
+					RebuildIndex(capacity);
 			}
+		}
 
-			return false;
+		template<class TLookup = TKey>
+			requires SequenceMapLookup<TKey, TLookup>
+		bool Contains(const TLookup& key) const
+		{
+			return FindPosition(key) != NotFound;
 		}
 
 		void Insert(const TKey& key, TValue value)
 		{
-			auto [wasInserted, valueReference] = TryInsert(key, std::move(value));
+			Emplace(key, std::move(value));
+		}
+
+		std::pair<bool, TValue*> TryInsert(TKey key, TValue value)
+		{
+			return TryEmplace(std::move(key), std::move(value));
+		}
+
+		/// <summary>
+		/// Construct a new entry in place from the key and the value arguments
+		/// Nothing is constructed when the key already exists.
+		/// </summary>
+		template<class TLookup, class... TArgs>
+			requires SequenceMapLookup<TKey, TLookup> && std::constructible_from<TKey, TLookup&&>
+		std::pair<bool, TValue*> TryEmplace(TLookup&& key, TArgs&&... args)
+		{
+			// Hash the key once for both the lookup and the new entry
+			auto hash = HashKey(key);
+			if (FindPosition(key, hash) != NotFound)
+				return std::make_pair<bool, TValue*>(false, nullptr);
+
+			auto& entry = _data.emplace_back(
+				std::piecewise_construct,
+				std::forward_as_tuple(std::forward<TLookup>(key)),
+				std::forward_as_tuple(std::forward<TArgs>(args)...));
+			IndexLastEntry(hash);
+			return std::make_pair<bool, TValue*>(true, &entry.second);
+		}
+
+		/// <summary>
+		/// Construct a new entry in place and throw if the key already exists
+		/// </summary>
+		template<class TLookup, class... TArgs>
+			requires SequenceMapLookup<TKey, TLookup> && std::constructible_from<TKey, TLookup&&>
+		TValue& Emplace(TLookup&& key, TArgs&&... args)
+		{
+			auto [wasInserted, valueReference] = TryEmplace(std::forward<TLookup>(key), std::forward<TArgs>(args)...);
 			if (!wasInserted)
 			{
 				throw std::runtime_error("Key already exists");
 			}
+
+			return *valueReference;
 		}
 
-		std::pair<bool, TValue*> TryInsert(TKey key, TValue value)
+		/// <summary>
+		/// Remove the entry with the key and shift the following entries down to keep their order
+		/// </summary>
+		template<class TLookup = TKey>
+			requires SequenceMapLookup<TKey, TLookup>
+		bool Erase(const TLookup& key)
 		{
-			if (Contains(key))
-			{
-				return std::make_pair<bool, TValue*>(false, nullptr);
-			}
-			else
+			auto position = FindPosition(key);
+			if (position == NotFound)
+				return false;
+
+			if constexpr (SequenceMapHashable<TKey>)
 			{
-				_data.push_back(std::make_pair<TKey, TValue>(std::move(key), std::move(value)));
-				auto& valueReference = _data[_data.size() - 1];
-				return std::make_pair<bool, TValue*>(true, &valueReference.second);;
+				if (_index.IsAllocated())
+					EraseIndex(position);
+				_fingerprints.erase(_fingerprints.begin() + static_cast<std::ptrdiff_t>(position));
 			}
+
+			_data.erase(_data.begin() + static_cast<std::ptrdiff_t>(position));
+			return true;
 		}
 
-		bool TryGet(const TKey key, TValue*& value)
+		template<class TLookup = TKey>
+			requires SequenceMapLookup<TKey, TLookup>
+		bool TryGet(const TLookup& key, TValue*& value)
 		{
-			for (auto& entry : _data)
+			auto position = FindPosition(key);
+			if (position != NotFound)
 			{
-				if (entry.first == key)
-				{
-					value = &entry.second;
-					return true;
-				}
+				value = &_data[position].second;
+				return true;
 			}
 
 			value = nullptr;
 			return false;
 		}
 
-		bool TryGet(const TKey key, const TValue*& value) const
+		template<class TLookup = TKey>
+			requires SequenceMapLookup<TKey, TLookup>
+		bool TryGet(const TLookup& key, const TValue*& value) const
 		{
-			for (const auto& entry : _data)
+			auto position = FindPosition(key);
+			if (position != NotFound)
 			{
-				if (entry.first == key)
-				{
-					value = &entry.second;
-					return true;
-				}
+				value = &_data[position].second;
+				return true;
 			}
 
 			value = nullptr;
@@ -126,12 +272,14 @@ namespace Opal
 		/// <summary>
 		/// Equality operator
 		/// </summary>
-		bool operator ==(const SequenceMap<TKey, TValue>& rhs) const
+		bool operator ==(const SequenceMap& rhs) const
 		{
 			return _data == rhs._data;
 		}
 		
-		const TValue& operator[](const TKey& key) const
+		template<class TLookup = TKey>
+			requires SequenceMapLookup<TKey, TLookup>
+		const TValue& operator[](const TLookup& key) const
 		{
 			const TValue* value;
 			if (TryGet(key, value))
@@ -147,7 +295,207 @@ namespace Opal
 		SequenceMap& operator=(const SequenceMap& other)
 		{
 			_data = other._data;
+			_fingerprints = other._fingerprints;
+			_index = other._index;
 			return *this;
 		}
+
+	private:
+		bool NeedsIndex() const noexcept
+		{
+			if constexpr (SequenceMapHashable<TKey>)
+				return _data.size() > IndexThreshold;
+			else
+				return false;
+		}
+
+		/// <summary>
+		/// Hash a key and spread the bits so sequential keys and identity hashes still fill every slot
+		/// String keys hash any lookup as a string view, which the standard guarantees matches the string
+		/// hash, and other lookups are converted to the key type first. Keys without a hash are all zero.
+		/// </summary>
+		template<class TLookup>
+		static uint32_t HashKey(const TLookup& key)
+		{
+			using KeyView = typename SequenceMapKeyView<TKey>::Type;
+			uint64_t hash;
+			if constexpr (!SequenceMapHashable<TKey>)
+			{
+				return 0;
+			}
+			else if constexpr (!std::is_void_v<KeyView> && std::is_convertible_v<const TLookup&, KeyView>)
+			{
+				hash = std::hash<KeyView>()(KeyView(key));
+			}
+			else if constexpr (std::is_same_v<TLookup, TKey>)
+			{
+				hash = std::hash<TKey>()(key);
+			}
+			else
+			{
+				hash = std::hash<TKey>()(TKey(key));
+			}
+
+			return static_cast<uint32_t>((hash * 0x9E3779B97F4A7C15) >> 32);
+		}
+
+		static uint8_t GetFingerprint(uint32_t hash) noexcept
+		{
+			return static_cast<uint8_t>(hash >> 24);
+		}
+
+		/// <summary>
+		/// Find the position of the entry with the key, through the index when there is one
+		/// </summary>
+		template<class TLookup>
+		size_t FindPosition(const TLookup& key) const
+		{
+			if (_data.size() < FingerprintThreshold)
+				return FindKeyPosition(key);
+
+			return FindPosition(key, HashKey(key));
+		}
+
+		template<class TLookup>
+		size_t FindPosition(const TLookup& key, uint32_t hash) const
+		{
+			if constexpr (SequenceMapHashable<TKey>)
+			{
+				if (!_index.IsAllocated())
+					return FindFingerprintPosition(key, GetFingerprint(hash));
+
+				auto slot = _index.FindSlot(hash, [&](size_t position) { return _data[position].first == key; });
+				return slot != HashIndex::NotFound ? _index.GetPosition(slot) : NotFound;
+			}
+			else
+			{
+				return FindKeyPosition(key);
+			}
+		}
+
+		template<class TLookup>
+		size_t FindKeyPosition(const TLookup& key) const
+		{
+			for (size_t position = 0; position < _data.size(); position++)
+			{
+				if (_data[position].first == key)
+					return position;
+			}
+
+			return NotFound;
+		}
+
+		/// <summary>
+		/// Scan the fingerprints for the key and only compare the keys of the entries that match
+		/// Note: The word scan may report a false match above a real one, which the key compare rejects
+		/// </summary>
+		template<class TLookup>
+		size_t FindFingerprintPosition(const TLookup& key, uint8_t fingerprint) const
+		{
+			auto fingerprints = _fingerprints.data();
+			auto count = _fingerprints.size();
+			size_t offset = 0;
+
+			#ifdef OPAL_SEQUENCE_MAP_SSE2
+			auto target = _mm_set1_epi8(static_cast<char>(fingerprint));
+			for (; offset + sizeof(__m128i) <= count; offset += sizeof(__m128i))
+			{
+				auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(fingerprints + offset));
+				auto matches = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, target)));
+				for (; matches != 0; matches &= matches - 1)
+				{
+					auto position = offset + static_cast<size_t>(std::countr_zero(matches));
+					if (_data[position].first == key)
+						return position;
+				}
+			}
+			#endif
+
+			if constexpr (std::endian::native == std::endian::little)
+			{
+				constexpr uint64_t LowBits = 0x0101010101010101;
+				constexpr uint64_t HighBits = 0x8080808080808080;
+				for (; offset + sizeof(uint64_t) <= count; offset += sizeof(uint64_t))
+				{
+					uint64_t block;
+					std::memcpy(&block, fingerprints + offset, sizeof(uint64_t));
+					auto difference = block ^ (LowBits * fingerprint);
+					auto matches = (difference - LowBits) & ~difference & HighBits;
+					for (; matches != 0; matches &= matches - 1)
+					{
+						auto position = offset + static_cast<size_t>(std::countr_zero(matches)) / 8;
+						if (_data[position].first == key)
+							return position;
+					}
+				}
+			}
+
+			for (; offset < count; offset++)
+			{
+				if (fingerprints[offset] == fingerprint && _data[offset].first == key)
+					return offset;
+			}
+
+			return NotFound;
+		}
+
+		/// <summary>
+		/// Add the fingerprint of the newest entry and add it to the index, building the index when the map
+		/// first passes the threshold
+		/// </summary>
+		void IndexLastEntry(uint32_t hash)
+		{
+			if constexpr (SequenceMapHashable<TKey>)
+			{
+				// Start with a full block of fingerprints to avoid growing through the smallest sizes
+				if (_fingerprints.capacity() == 0)
+					_fingerprints.reserve(FingerprintBlockSize);
+
+				_fingerprints.push_back(GetFingerprint(hash));
+				if (!_index.IsAllocated())
+				{
+					// Build the index once the map passes the threshold, which adds this entry with the others
+					if (NeedsIndex())
+						RebuildIndex(2 * _data.size());
+
+					return;
+				}
+
+				if (_index.NeedsGrowth(_data.size()))
+					_index.Rebuild(2 * _data.size());
+
+				_index.Insert(hash, _data.size() - 1);
+			}
+		}
+
+		/// <summary>
+		/// Resize the index to fit the requested number of entries, adding the current entries when it is first built
+		/// Note: A built index re-adds the entries from its stored hashes so the keys are not hashed again
+		/// </summary>
+		void RebuildIndex(size_t capacity)
+		{
+			if constexpr (SequenceMapHashable<TKey>)
+			{
+				bool isFirstBuild = !_index.IsAllocated();
+				_index.Rebuild(capacity);
+				if (isFirstBuild)
+				{
+					for (size_t position = 0; position < _data.size(); position++)
+						_index.Insert(HashKey(_data[position].first), position);
+				}
+			}
+		}
+
+		/// <summary>
+		/// Remove the entry at the position from the index and move every later position down by one
+		/// </summary>
+		void EraseIndex(size_t position)
+		{
+			auto slot = _index.FindSlot(
+				HashKey(_data[position].first),
+				[&](size_t current) { return current == position; });
+			_index.Erase(slot);
+			_index.ShiftDown(position);
+		}
 	};
 }
@@ -0,0 +1,296 @@
+﻿// <copyright file="version-index.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+#pragma once
+#include "packed-semantic-version.h"
+
+namespace Opal
+{
+	/// <summary>
+	/// An index of the known versions for each package that answers version constraint queries
+	/// The versions of each package are kept packed and sorted in a contiguous list, so every query is
+	/// a binary search over eight byte integers after a single hash lookup for the package.
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	class VersionIndex
+	{
+	private:
+		static constexpr char VersionSeparator = '@';
+
+		/// <summary>
+		/// Hash package names so they can be found from a string view without a copy
+		/// </summary>
+		struct PackageNameHash
+		{
+			using is_transparent = void;
+
+			size_t operator()(std::string_view value) const noexcept
+			{
+				return std::hash<std::string_view>()(value);
+			}
+		};
+
+		using VersionList = std::vector<PackedSemanticVersion>;
+
+		std::unordered_map<std::string, VersionList, PackageNameHash, std::equal_to<>> _packages;
+		size_t _versionCount;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref="VersionIndex"/> class.
+		/// </summary>
+		VersionIndex() :
+			_packages(),
+			_versionCount(0)
+		{
+		}
+
+		/// <summary>
+		/// Gets the number of packages
+		/// </summary>
+		size_t GetPackageCount() const noexcept
+		{
+			return _packages.size();
+		}
+
+		/// <summary>
+		/// Gets the number of unique versions across all packages
+		/// </summary>
+		size_t GetVersionCount() const noexcept
+		{
+			return _versionCount;
+		}
+
+		/// <summary>
+		/// Add a single version of a package
+		/// Returns false if an equal version is already known.
+		/// Note: Each add shifts the later versions of the package, use <see cref="Load"/> for large catalogs
+		/// </summary>
+		bool Add(std::string_view package, const SemanticVersion& version)
+		{
+			auto packed = PackedSemanticVersion(version);
+			auto& versions = GetOrAddPackage(package);
+			auto location = std::lower_bound(versions.begin(), versions.end(), packed);
+			if (location != versions.end() && *location == packed)
+				return false;
+
+			versions.insert(location, packed);
+			_versionCount++;
+			return true;
+		}
+
+		/// <summary>
+		/// Load a catalog with one "{Package}@{Version}" entry per line
+		/// Every version is parsed straight into its packed form and the entries are ordered with a single packed radix sort
+		/// before they are appended to their packages. Versions outside the strict packed grammar fall back to the
+		/// SemanticVersion parser, so any entry that Add accepts also loads.
+		/// Note: The entries are all validated before any are added, so an invalid catalog changes nothing
+		/// </summary>
+		void Load(std::string_view content)
+		{
+			auto entries = std::vector<std::pair<std::string_view, PackedSemanticVersion>>();
+			size_t lineStart = 0;
+			auto parseLine = [&](size_t lineEnd)
+			{
+				auto line = content.substr(lineStart, lineEnd - lineStart);
+				lineStart = lineEnd + 1;
+				if (!line.empty() && line.back() == '\r')
+					line.remove_suffix(1);
+				if (line.empty())
+					return;
+
+				auto separator = line.rfind(VersionSeparator);
+				if (separator == std::string_view::npos)
+					throw std::runtime_error(std::format("Invalid package version entry: {}", line));
+
+				auto versionText = line.substr(separator + 1);
+				PackedSemanticVersion packed;
+				if (!PackedSemanticVersion::TryParse(versionText, packed))
+				{
+					SemanticVersion version;
+					if (!SemanticVersion::TryParse(versionText, version) ||
+						!PackedSemanticVersion::TryCreate(version, packed))
+					{
+						throw std::runtime_error(std::format("Invalid package version entry: {}", line));
+					}
+				}
+
+				entries.emplace_back(line.substr(0, separator), packed);
+			};
+
+			PathScan::ForEachMatch(content, '\n', '\n', parseLine);
+			if (lineStart < content.size())
+				parseLine(content.size());
+
+			// Sort every entry by version up front so each package receives its versions in ascending order
+			// and only the packages that already had newer or equal versions have to be sorted again
+			// Note: The lists are node based so the references are stable while adding packages
+			PackedSemanticVersion::SortBy(
+				std::span<std::pair<std::string_view, PackedSemanticVersion>>(entries),
+				[](const std::pair<std::string_view, PackedSemanticVersion>& entry) { return entry.second; });
+
+			auto changedPackages = std::unordered_set<VersionList*>();
+			VersionList* versions = nullptr;
+			std::string_view package;
+			for (auto& [entryPackage, version] : entries)
+			{
+				if (versions == nullptr || entryPackage != package)
+				{
+					package = entryPackage;
+					versions = &GetOrAddPackage(package);
+				}
+
+				if (!versions->empty() && !(versions->back() < version))
+					changedPackages.insert(versions);
+
+				versions->push_back(version);
+				_versionCount++;
+			}
+
+			for (auto changedVersions : changedPackages)
+			{
+				PackedSemanticVersion::Sort(std::span<PackedSemanticVersion>(*changedVersions));
+				auto uniqueEnd = std::unique(changedVersions->begin(), changedVersions->end());
+				_versionCount -= static_cast<size_t>(changedVersions->end() - uniqueEnd);
+				changedVersions->erase(uniqueEnd, changedVersions->end());
+			}
+		}
+
+		/// <summary>
+		/// Get all of the versions of a package in ascending order
+		/// Note: The versions are only valid until the index is next modified
+		/// </summary>
+		std::span<const PackedSemanticVersion> GetVersions(std::string_view package) const
+		{
+			auto versions = TryGetPackage(package);
+			if (versions == nullptr)
+				return {};
+
+			return *versions;
+		}
+
+		/// <summary>
+		/// Get the versions of a package within the range [minimum, maximum)
+		/// </summary>
+		std::span<const PackedSemanticVersion> GetRange(
+			std::string_view package,
+			const SemanticVersion& minimum,
+			const SemanticVersion& maximum) const
+		{
+			auto versions = GetVersions(package);
+			auto start = LowerBound(versions, minimum);
+			auto end = LowerBound(versions, maximum);
+			if (end <= start)
+				return {};
+
+			return versions.subspan(start, end - start);
+		}
+
+		/// <summary>
+		/// Try get the latest version of a package
+		/// </summary>
+		bool TryGetLatest(std::string_view package, SemanticVersion& result) const
+		{
+			auto versions = GetVersions(package);
+			if (versions.empty())
+				return false;
+
+			result = versions.back().ToSemanticVersion();
+			return true;
+		}
+
+		/// <summary>
+		/// Try get the latest version of a package that matches every value present in the reference
+		/// A reference of "1" matches the latest 1.x.x, "1.2" matches the latest 1.2.x and "1.2.3" must
+		/// match exactly.
+		/// </summary>
+		bool TryGetBestMatch(std::string_view package, const SemanticVersion& reference, SemanticVersion& result) const
+		{
+			auto versions = GetVersions(package);
+			auto end = std::partition_point(versions.begin(), versions.end(), [&](const PackedSemanticVersion& version)
+			{
+				if (version.GetMajor() != reference.GetMajor())
+					return version.GetMajor() < reference.GetMajor();
+				if (!reference.HasMinor())
+					return true;
+				if (version.GetMinorOrDefault() != reference.GetMinor())
+					return version.GetMinorOrDefault() < reference.GetMinor();
+				return !reference.HasPatch() || version.GetPatchOrDefault() <= reference.GetPatch();
+			});
+
+			if (end == versions.begin())
+				return false;
+
+			auto match = *(end - 1);
+			if (match.GetMajor() != reference.GetMajor() ||
+				(reference.HasMinor() && match.GetMinorOrDefault() != reference.GetMinor()) ||
+				(reference.HasMinor() && reference.HasPatch() && match.GetPatchOrDefault() != reference.GetPatch()))
+			{
+				return false;
+			}
+
+			result = match.ToSemanticVersion();
+			return true;
+		}
+
+		/// <summary>
+		/// Try get the latest version of a package with the same major that is at least the minimum
+		/// </summary>
+		bool TryGetLatestCompatible(std::string_view package, const SemanticVersion& minimum, SemanticVersion& result) const
+		{
+			auto versions = GetVersions(package);
+			auto end = std::partition_point(versions.begin(), versions.end(), [&](const PackedSemanticVersion& version)
+			{
+				return version.GetMajor() <= minimum.GetMajor();
+			});
+
+			if (end == versions.begin())
+				return false;
+
+			auto match = (end - 1)->ToSemanticVersion();
+			if (match.GetMajor() != minimum.GetMajor() || match < minimum)
+				return false;
+
+			result = match;
+			return true;
+		}
+
+	private:
+		VersionList& GetOrAddPackage(std::string_view package)
+		{
+			auto findResult = _packages.find(package);
+			if (findResult != _packages.end())
+				return findResult->second;
+
+			return _packages.emplace(std::string(package), VersionList()).first->second;
+		}
+
+		const VersionList* TryGetPackage(std::string_view package) const
+		{
+			auto findResult = _packages.find(package);
+			if (findResult == _packages.end())
+				return nullptr;
+
+			return &findResult->second;
+		}
+
+		/// <summary>
+		/// Find the first version that is not less than the value
+		/// </summary>
+		static size_t LowerBound(std::span<const PackedSemanticVersion> versions, const SemanticVersion& value)
+		{
+			PackedSemanticVersion packed;
+			if (PackedSemanticVersion::TryCreate(value, packed))
+				return static_cast<size_t>(std::lower_bound(versions.begin(), versions.end(), packed) - versions.begin());
+
+			// Compare the unpacked versions when the value is outside of the packed range
+			auto location = std::partition_point(versions.begin(), versions.end(), [&](const PackedSemanticVersion& version)
+			{
+				return version.ToSemanticVersion() < value;
+			});
+			return static_cast<size_t>(location - versions.begin());
+		}
+	};
+}
@@ -1,12 +1,15 @@
 #include <any>
+#include <array>
 #include <fstream>
 #include <iostream>
 #include <map>
 #include <memory>
+#include <memory_resource>
 #include <optional>
 #include <queue>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 import Opal;
@@ -17,7 +20,18 @@ using namespace Opal::System;
 using namespace Soup::Test;
 
 #include "utils/path-tests.gen.h"
+#include "utils/path-list-tests.gen.h"
+#include "utils/path-list-parser-tests.gen.h"
+#include "utils/path-map-tests.gen.h"
+#include "utils/path-pool-tests.gen.h"
+#include "utils/path-trie-tests.gen.h"
+#include "utils/path-view-tests.gen.h"
+#include "utils/relative-path-resolver-tests.gen.h"
+#include "utils/packed-semantic-version-tests.gen.h"
 #include "utils/semantic-version-tests.gen.h"
+#include "utils/sequence-map-tests.gen.h"
+#include "utils/version-index-tests.gen.h"
+#include "system/mock-file-system-tests.gen.h"
 
 int main()
 {
@@ -26,7 +40,18 @@ int main()
 	TestState state = { 0, 0 };
 
 	state += RunPathTests();
+	state += RunPathListTests();
+	state += RunPathListParserTests();
+	state += RunPathMapTests();
+	state += RunPathPoolTests();
+	state += RunPathTrieTests();
+	state += RunPathViewTests();
+	state += RunRelativePathResolverTests();
+	state += RunPackedSemanticVersionTests();
 	state += RunSemanticVersionTests();
+	state += RunSequenceMapTests();
+	state += RunVersionIndexTests();
+	state += RunMockFileSystemTests();
 
 	// Touch stamp file to ensure incremental builds work
 	// auto testFile = std::fstream("TestHarness.stamp", std::fstream::out);
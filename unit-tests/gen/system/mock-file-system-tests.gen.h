@@ -0,0 +1,13 @@
+#pragma once
+#include "system/mock-file-system-tests.h"
+
+TestState RunMockFileSystemTests() 
+ {
+	auto className = "MockFileSystemTests";
+	auto testClass = std::make_shared<Soup::UnitTests::MockFileSystemTests>();
+	TestState state = { 0, 0 };
+	state += Soup::Test::RunTest(className, "Exists_MatchesCase", [&testClass]() { testClass->Exists_MatchesCase(); });
+	state += Soup::Test::RunTest(className, "CaseInsensitive_Exists_IgnoresCase", [&testClass]() { testClass->CaseInsensitive_Exists_IgnoresCase(); });
+
+	return state;
+}
\ No newline at end of file
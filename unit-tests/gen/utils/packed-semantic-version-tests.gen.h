@@ -0,0 +1,46 @@
+#pragma once
+#include "utils/packed-semantic-version-tests.h"
+
+TestState RunPackedSemanticVersionTests() 
+ {
+	auto className = "PackedSemanticVersionTests";
+	auto testClass = std::make_shared<Soup::UnitTests::PackedSemanticVersionTests>();
+	TestState state = { 0, 0 };
+	state += Soup::Test::RunTest(className, "DefaultInitializer", [&testClass]() { testClass->DefaultInitializer(); });
+	state += Soup::Test::RunTest(className, "InitializeValues(1, 2, 3)", [&testClass]() { testClass->InitializeValues(1, 2, 3); });
+	state += Soup::Test::RunTest(className, "InitializeValues(0, 0, 0)", [&testClass]() { testClass->InitializeValues(0, 0, 0); });
+	state += Soup::Test::RunTest(className, "InitializeValues(4194303, 1048575, 1048575)", [&testClass]() { testClass->InitializeValues(4194303, 1048575, 1048575); });
+	state += Soup::Test::RunTest(className, "InitializeMissingValues", [&testClass]() { testClass->InitializeMissingValues(); });
+	state += Soup::Test::RunTest(className, "TryCreate_OutOfRange", [&testClass]() { testClass->TryCreate_OutOfRange(); });
+	state += Soup::Test::RunTest(className, "TryParseValues(\"1\", 1, -1, -1)", [&testClass]() { testClass->TryParseValues("1", 1, -1, -1); });
+	state += Soup::Test::RunTest(className, "TryParseValues(\"1.2\", 1, 2, -1)", [&testClass]() { testClass->TryParseValues("1.2", 1, 2, -1); });
+	state += Soup::Test::RunTest(className, "TryParseValues(\"1.2.3\", 1, 2, 3)", [&testClass]() { testClass->TryParseValues("1.2.3", 1, 2, 3); });
+	state += Soup::Test::RunTest(className, "TryParseValues(\"0.0.0\", 0, 0, 0)", [&testClass]() { testClass->TryParseValues("0.0.0", 0, 0, 0); });
+	state += Soup::Test::RunTest(className, "TryParseValues(\"007.10.0100\", 7, 10, 100)", [&testClass]() { testClass->TryParseValues("007.10.0100", 7, 10, 100); });
+	state += Soup::Test::RunTest(className, "TryParseValues(\"4194303.1048575.1048575\", 4194303, 1048575, 1048575)", [&testClass]() { testClass->TryParseValues("4194303.1048575.1048575", 4194303, 1048575, 1048575); });
+	state += Soup::Test::RunTest(className, "TryParseValues(\"12345.67890.1023456\", 12345, 67890, 1023456)", [&testClass]() { testClass->TryParseValues("12345.67890.1023456", 12345, 67890, 1023456); });
+	state += Soup::Test::RunTest(className, "TryParseInvalidValues(\"\")", [&testClass]() { testClass->TryParseInvalidValues(""); });
+	state += Soup::Test::RunTest(className, "TryParseInvalidValues(\".\")", [&testClass]() { testClass->TryParseInvalidValues("."); });
+	state += Soup::Test::RunTest(className, "TryParseInvalidValues(\"1.\")", [&testClass]() { testClass->TryParseInvalidValues("1."); });
+	state += Soup::Test::RunTest(className, "TryParseInvalidValues(\".1\")", [&testClass]() { testClass->TryParseInvalidValues(".1"); });
+	state += Soup::Test::RunTest(className, "TryParseInvalidValues(\"1..2\")", [&testClass]() { testClass->TryParseInvalidValues("1..2"); });
+	state += Soup::Test::RunTest(className, "TryParseInvalidValues(\"1.2.3.4\")", [&testClass]() { testClass->TryParseInvalidValues("1.2.3.4"); });
+	state += Soup::Test::RunTest(className, "TryParseInvalidValues(\"-1.2.3\")", [&testClass]() { testClass->TryParseInvalidValues("-1.2.3"); });
+	state += Soup::Test::RunTest(className, "TryParseInvalidValues(\"+1.2.3\")", [&testClass]() { testClass->TryParseInvalidValues("+1.2.3"); });
+	state += Soup::Test::RunTest(className, "TryParseInvalidValues(\"1.2.3 \")", [&testClass]() { testClass->TryParseInvalidValues("1.2.3 "); });
+	state += Soup::Test::RunTest(className, "TryParseInvalidValues(\"1.2.3-beta\")", [&testClass]() { testClass->TryParseInvalidValues("1.2.3-beta"); });
+	state += Soup::Test::RunTest(className, "TryParseInvalidValues(\"1.a.3\")", [&testClass]() { testClass->TryParseInvalidValues("1.a.3"); });
+	state += Soup::Test::RunTest(className, "TryParseInvalidValues(\"4194304.0.0\")", [&testClass]() { testClass->TryParseInvalidValues("4194304.0.0"); });
+	state += Soup::Test::RunTest(className, "TryParseInvalidValues(\"1.1048576.0\")", [&testClass]() { testClass->TryParseInvalidValues("1.1048576.0"); });
+	state += Soup::Test::RunTest(className, "TryParseInvalidValues(\"1.2.1048576\")", [&testClass]() { testClass->TryParseInvalidValues("1.2.1048576"); });
+	state += Soup::Test::RunTest(className, "TryParseInvalidValues(\"12345678.0.0\")", [&testClass]() { testClass->TryParseInvalidValues("12345678.0.0"); });
+	state += Soup::Test::RunTest(className, "TryParseInvalidValues(\"1.2.00000003\")", [&testClass]() { testClass->TryParseInvalidValues("1.2.00000003"); });
+	state += Soup::Test::RunTest(className, "Parse_Invalid", [&testClass]() { testClass->Parse_Invalid(); });
+	state += Soup::Test::RunTest(className, "ParseMany_Values", [&testClass]() { testClass->ParseMany_Values(); });
+	state += Soup::Test::RunTest(className, "ParseMany_Lines", [&testClass]() { testClass->ParseMany_Lines(); });
+	state += Soup::Test::RunTest(className, "Comparisons_MatchSemanticVersion", [&testClass]() { testClass->Comparisons_MatchSemanticVersion(); });
+	state += Soup::Test::RunTest(className, "Sort_Packed", [&testClass]() { testClass->Sort_Packed(); });
+	state += Soup::Test::RunTest(className, "Sort_SemanticVersions", [&testClass]() { testClass->Sort_SemanticVersions(); });
+
+	return state;
+}
\ No newline at end of file
@@ -0,0 +1,22 @@
+#pragma once
+#include "utils/path-list-parser-tests.h"
+
+TestState RunPathListParserTests() 
+ {
+	auto className = "PathListParserTests";
+	auto testClass = std::make_shared<Soup::UnitTests::PathListParserTests>();
+	TestState state = { 0, 0 };
+	state += Soup::Test::RunTest(className, "ParseLines_Empty", [&testClass]() { testClass->ParseLines_Empty(); });
+	state += Soup::Test::RunTest(className, "ParseLines_Trimmed", [&testClass]() { testClass->ParseLines_Trimmed(); });
+	state += Soup::Test::RunTest(className, "ParseLines_Appends", [&testClass]() { testClass->ParseLines_Appends(); });
+	state += Soup::Test::RunTest(className, "ParseDependencies_SingleLine", [&testClass]() { testClass->ParseDependencies_SingleLine(); });
+	state += Soup::Test::RunTest(className, "ParseDependencies_LineContinuations", [&testClass]() { testClass->ParseDependencies_LineContinuations(); });
+	state += Soup::Test::RunTest(className, "ParseDependencies_Escapes", [&testClass]() { testClass->ParseDependencies_Escapes(); });
+	state += Soup::Test::RunTest(className, "ParseDependencies_MultipleRules", [&testClass]() { testClass->ParseDependencies_MultipleRules(); });
+	state += Soup::Test::RunTest(className, "ParseDependencies_Tabs", [&testClass]() { testClass->ParseDependencies_Tabs(); });
+	state += Soup::Test::RunTest(className, "ParseDependencies_Comments", [&testClass]() { testClass->ParseDependencies_Comments(); });
+	state += Soup::Test::RunTest(className, "ParseLines_Views", [&testClass]() { testClass->ParseLines_Views(); });
+	state += Soup::Test::RunTest(className, "ParseDependencies_Views", [&testClass]() { testClass->ParseDependencies_Views(); });
+
+	return state;
+}
\ No newline at end of file
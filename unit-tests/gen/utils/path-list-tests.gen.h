@@ -0,0 +1,17 @@
+#pragma once
+#include "utils/path-list-tests.h"
+
+TestState RunPathListTests() 
+ {
+	auto className = "PathListTests";
+	auto testClass = std::make_shared<Soup::UnitTests::PathListTests>();
+	TestState state = { 0, 0 };
+	state += Soup::Test::RunTest(className, "Empty_RoundTrip", [&testClass]() { testClass->Empty_RoundTrip(); });
+	state += Soup::Test::RunTest(className, "ReadAll_Views", [&testClass]() { testClass->ReadAll_Views(); });
+	state += Soup::Test::RunTest(className, "ReadAll_Paths", [&testClass]() { testClass->ReadAll_Paths(); });
+	state += Soup::Test::RunTest(className, "Write_SharesPrefix", [&testClass]() { testClass->Write_SharesPrefix(); });
+	state += Soup::Test::RunTest(className, "Read_InvalidHeader", [&testClass]() { testClass->Read_InvalidHeader(); });
+	state += Soup::Test::RunTest(className, "Read_Truncated", [&testClass]() { testClass->Read_Truncated(); });
+
+	return state;
+}
\ No newline at end of file
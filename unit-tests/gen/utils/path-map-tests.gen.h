@@ -0,0 +1,20 @@
+#pragma once
+#include "utils/path-map-tests.h"
+
+TestState RunPathMapTests() 
+ {
+	auto className = "PathMapTests";
+	auto testClass = std::make_shared<Soup::UnitTests::PathMapTests>();
+	TestState state = { 0, 0 };
+	state += Soup::Test::RunTest(className, "Initialize_Default", [&testClass]() { testClass->Initialize_Default(); });
+	state += Soup::Test::RunTest(className, "Insert_Unique", [&testClass]() { testClass->Insert_Unique(); });
+	state += Soup::Test::RunTest(className, "TryInsert_Duplicate", [&testClass]() { testClass->TryInsert_Duplicate(); });
+	state += Soup::Test::RunTest(className, "TryGet_Missing", [&testClass]() { testClass->TryGet_Missing(); });
+	state += Soup::Test::RunTest(className, "Erase_Many", [&testClass]() { testClass->Erase_Many(); });
+	state += Soup::Test::RunTest(className, "PathSet_InsertErase", [&testClass]() { testClass->PathSet_InsertErase(); });
+	state += Soup::Test::RunTest(className, "CaseInsensitive_TryGet", [&testClass]() { testClass->CaseInsensitive_TryGet(); });
+	state += Soup::Test::RunTest(className, "CaseInsensitive_Comparers", [&testClass]() { testClass->CaseInsensitive_Comparers(); });
+	state += Soup::Test::RunTest(className, "Comparers_UnorderedMap_PathViewLookup", [&testClass]() { testClass->Comparers_UnorderedMap_PathViewLookup(); });
+
+	return state;
+}
\ No newline at end of file
@@ -0,0 +1,15 @@
+#pragma once
+#include "utils/path-pool-tests.h"
+
+TestState RunPathPoolTests() 
+ {
+	auto className = "PathPoolTests";
+	auto testClass = std::make_shared<Soup::UnitTests::PathPoolTests>();
+	TestState state = { 0, 0 };
+	state += Soup::Test::RunTest(className, "Initialize_Default", [&testClass]() { testClass->Initialize_Default(); });
+	state += Soup::Test::RunTest(className, "Intern_Unique", [&testClass]() { testClass->Intern_Unique(); });
+	state += Soup::Test::RunTest(className, "Intern_Duplicate", [&testClass]() { testClass->Intern_Duplicate(); });
+	state += Soup::Test::RunTest(className, "TryFind_Missing", [&testClass]() { testClass->TryFind_Missing(); });
+
+	return state;
+}
\ No newline at end of file
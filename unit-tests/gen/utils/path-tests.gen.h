@@ -14,7 +14,10 @@ TestState RunPathTests()
 	state += Soup::Test::RunTest(className, "Initialize_WindowsRoot", [&testClass]() { testClass->Initialize_WindowsRoot(); });
 	state += Soup::Test::RunTest(className, "Initialize_LinuxRoot", [&testClass]() { testClass->Initialize_LinuxRoot(); });
 	state += Soup::Test::RunTest(className, "Initialize_SimpleAbsolutePath", [&testClass]() { testClass->Initialize_SimpleAbsolutePath(); });
+	state += Soup::Test::RunTest(className, "Initialize_LongPath", [&testClass]() { testClass->Initialize_LongPath(); });
 	state += Soup::Test::RunTest(className, "Parse_AlternativeDirectoriesPath", [&testClass]() { testClass->Parse_AlternativeDirectoriesPath(); });
+	state += Soup::Test::RunTest(className, "Parse_LongAlternativeDirectoriesPath", [&testClass]() { testClass->Parse_LongAlternativeDirectoriesPath(); });
+	state += Soup::Test::RunTest(className, "CreateWindows_LongPath", [&testClass]() { testClass->CreateWindows_LongPath(); });
 	state += Soup::Test::RunTest(className, "Parse_RemoveEmptyDirectoryInside", [&testClass]() { testClass->Parse_RemoveEmptyDirectoryInside(); });
 	state += Soup::Test::RunTest(className, "Parse_RemoveParentDirectoryInside", [&testClass]() { testClass->Parse_RemoveParentDirectoryInside(); });
 	state += Soup::Test::RunTest(className, "Parse_RemoveTwoParentDirectoryInside", [&testClass]() { testClass->Parse_RemoveTwoParentDirectoryInside(); });
@@ -27,18 +30,56 @@ TestState RunPathTests()
 	state += Soup::Test::RunTest(className, "Concatenate_Empty", [&testClass]() { testClass->Concatenate_Empty(); });
 	state += Soup::Test::RunTest(className, "Concatenate_RootFile", [&testClass]() { testClass->Concatenate_RootFile(); });
 	state += Soup::Test::RunTest(className, "Concatenate_RootFolder", [&testClass]() { testClass->Concatenate_RootFolder(); });
+	state += Soup::Test::RunTest(className, "Concatenate_LongPath", [&testClass]() { testClass->Concatenate_LongPath(); });
 	state += Soup::Test::RunTest(className, "Concatenate_UpDirectory", [&testClass]() { testClass->Concatenate_UpDirectory(); });
+	state += Soup::Test::RunTest(className, "Concatenate_MultipleUpDirectory", [&testClass]() { testClass->Concatenate_MultipleUpDirectory(); });
+	state += Soup::Test::RunTest(className, "Concatenate_UpDirectoryRelative", [&testClass]() { testClass->Concatenate_UpDirectoryRelative(); });
 	state += Soup::Test::RunTest(className, "Concatenate_TwoRelative", [&testClass]() { testClass->Concatenate_TwoRelative(); });
 	state += Soup::Test::RunTest(className, "Concatenate_UpDirectoryBeginning", [&testClass]() { testClass->Concatenate_UpDirectoryBeginning(); });
 	state += Soup::Test::RunTest(className, "SetFileExtension_Replace", [&testClass]() { testClass->SetFileExtension_Replace(); });
 	state += Soup::Test::RunTest(className, "SetFileExtension_Replace_Rooted", [&testClass]() { testClass->SetFileExtension_Replace_Rooted(); });
 	state += Soup::Test::RunTest(className, "SetFileExtension_Add", [&testClass]() { testClass->SetFileExtension_Add(); });
+	state += Soup::Test::RunTest(className, "SetFileExtension_LongPath", [&testClass]() { testClass->SetFileExtension_LongPath(); });
+	state += Soup::Test::RunTest(className, "SetFilename_MemoryResource", [&testClass]() { testClass->SetFilename_MemoryResource(); });
+	state += Soup::Test::RunTest(className, "SetFilename_OwnValue", [&testClass]() { testClass->SetFilename_OwnValue(); });
+	state += Soup::Test::RunTest(className, "SetFilename_EmptyDirectories", [&testClass]() { testClass->SetFilename_EmptyDirectories(); });
+	state += Soup::Test::RunTest(className, "GetParent_File", [&testClass]() { testClass->GetParent_File(); });
+	state += Soup::Test::RunTest(className, "GetParent_Directory", [&testClass]() { testClass->GetParent_Directory(); });
+	state += Soup::Test::RunTest(className, "GetParent_Relative", [&testClass]() { testClass->GetParent_Relative(); });
+	state += Soup::Test::RunTest(className, "GetParent_EmptyDirectories(\"./a//b/\", \"./a/\")", [&testClass]() { testClass->GetParent_EmptyDirectories("./a//b/", "./a/"); });
+	state += Soup::Test::RunTest(className, "GetParent_EmptyDirectories(\"C:/a//b/\", \"C:/a/\")", [&testClass]() { testClass->GetParent_EmptyDirectories("C:/a//b/", "C:/a/"); });
+	state += Soup::Test::RunTest(className, "GetParent_EmptyDirectories(\"C:/a//b/c/\", \"C:/a/b/\")", [&testClass]() { testClass->GetParent_EmptyDirectories("C:/a//b/c/", "C:/a/b/"); });
+	state += Soup::Test::RunTest(className, "GetParent_EmptyDirectories(\"C://a/\", \"C:/\")", [&testClass]() { testClass->GetParent_EmptyDirectories("C://a/", "C:/"); });
+	state += Soup::Test::RunTest(className, "GetParent_EmptyDirectories(\"//a/\", \"/\")", [&testClass]() { testClass->GetParent_EmptyDirectories("//a/", "/"); });
+	state += Soup::Test::RunTest(className, "GetParent_EmptyDirectories(\"C:/a//b/c.txt\", \"C:/a//b/\")", [&testClass]() { testClass->GetParent_EmptyDirectories("C:/a//b/c.txt", "C:/a//b/"); });
+	state += Soup::Test::RunTest(className, "GetComponents_Rooted", [&testClass]() { testClass->GetComponents_Rooted(); });
+	state += Soup::Test::RunTest(className, "GetComponents_Relative", [&testClass]() { testClass->GetComponents_Relative(); });
+	state += Soup::Test::RunTest(className, "GetComponent_Rooted", [&testClass]() { testClass->GetComponent_Rooted(); });
+	state += Soup::Test::RunTest(className, "GetComponent_Relative", [&testClass]() { testClass->GetComponent_Relative(); });
+	state += Soup::Test::RunTest(className, "BuildComponentIndex_TooDeep", [&testClass]() { testClass->BuildComponentIndex_TooDeep(); });
+	state += Soup::Test::RunTest(className, "CommonPrefixLength", [&testClass]() { testClass->CommonPrefixLength(); });
+	state += Soup::Test::RunTest(className, "GetParent_ComponentIndex", [&testClass]() { testClass->GetParent_ComponentIndex(); });
+	state += Soup::Test::RunTest(className, "GetParent_ComponentIndex_WalkToRoot(\"C:/a/bb/ccc/dddd/File.txt\")", [&testClass]() { testClass->GetParent_ComponentIndex_WalkToRoot("C:/a/bb/ccc/dddd/File.txt"); });
+	state += Soup::Test::RunTest(className, "GetParent_ComponentIndex_WalkToRoot(\"/a/bb/ccc/\")", [&testClass]() { testClass->GetParent_ComponentIndex_WalkToRoot("/a/bb/ccc/"); });
+	state += Soup::Test::RunTest(className, "GetParent_ComponentIndex_WalkToRoot(\"./a/bb/\")", [&testClass]() { testClass->GetParent_ComponentIndex_WalkToRoot("./a/bb/"); });
 	state += Soup::Test::RunTest(className, "GetRelativeTo_Empty", [&testClass]() { testClass->GetRelativeTo_Empty(); });
 	state += Soup::Test::RunTest(className, "GetRelativeTo_SingleRelative", [&testClass]() { testClass->GetRelativeTo_SingleRelative(); });
 	state += Soup::Test::RunTest(className, "GetRelativeTo_UpParentRelative", [&testClass]() { testClass->GetRelativeTo_UpParentRelative(); });
 	state += Soup::Test::RunTest(className, "GetRelativeTo_MismatchRelative", [&testClass]() { testClass->GetRelativeTo_MismatchRelative(); });
+	state += Soup::Test::RunTest(className, "GetRelativeTo_Directory", [&testClass]() { testClass->GetRelativeTo_Directory(); });
 	state += Soup::Test::RunTest(className, "GetRelativeTo_Rooted_DifferentRoot", [&testClass]() { testClass->GetRelativeTo_Rooted_DifferentRoot(); });
 	state += Soup::Test::RunTest(className, "GetRelativeTo_Rooted_SingleFolder", [&testClass]() { testClass->GetRelativeTo_Rooted_SingleFolder(); });
+	state += Soup::Test::RunTest(className, "GetHash_Equal", [&testClass]() { testClass->GetHash_Equal(); });
+	state += Soup::Test::RunTest(className, "GetHash_Modified", [&testClass]() { testClass->GetHash_Modified(); });
+	state += Soup::Test::RunTest(className, "Parse_MemoryResource", [&testClass]() { testClass->Parse_MemoryResource(); });
+	state += Soup::Test::RunTest(className, "Concatenate_MemoryResource", [&testClass]() { testClass->Concatenate_MemoryResource(); });
+	state += Soup::Test::RunTest(className, "Copy_MemoryResource", [&testClass]() { testClass->Copy_MemoryResource(); });
+	state += Soup::Test::RunTest(className, "Copy_SharesLongValue", [&testClass]() { testClass->Copy_SharesLongValue(); });
+	state += Soup::Test::RunTest(className, "SetFilename_DetachesSharedCopy", [&testClass]() { testClass->SetFilename_DetachesSharedCopy(); });
+	state += Soup::Test::RunTest(className, "TryCreate_Valid", [&testClass]() { testClass->TryCreate_Valid(); });
+	state += Soup::Test::RunTest(className, "TryCreate_Invalid", [&testClass]() { testClass->TryCreate_Invalid(); });
+	state += Soup::Test::RunTest(className, "TryCreate_MemoryResource", [&testClass]() { testClass->TryCreate_MemoryResource(); });
+	state += Soup::Test::RunTest(className, "TryGetRoot_TryGetFileName", [&testClass]() { testClass->TryGetRoot_TryGetFileName(); });
 
 	return state;
 }
\ No newline at end of file
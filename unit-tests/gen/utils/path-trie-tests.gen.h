@@ -0,0 +1,18 @@
+#pragma once
+#include "utils/path-trie-tests.h"
+
+TestState RunPathTrieTests() 
+ {
+	auto className = "PathTrieTests";
+	auto testClass = std::make_shared<Soup::UnitTests::PathTrieTests>();
+	TestState state = { 0, 0 };
+	state += Soup::Test::RunTest(className, "Initialize_Default", [&testClass]() { testClass->Initialize_Default(); });
+	state += Soup::Test::RunTest(className, "Insert_SharedPrefix", [&testClass]() { testClass->Insert_SharedPrefix(); });
+	state += Soup::Test::RunTest(className, "TryInsert_Duplicate", [&testClass]() { testClass->TryInsert_Duplicate(); });
+	state += Soup::Test::RunTest(className, "TryGetLongestPrefix", [&testClass]() { testClass->TryGetLongestPrefix(); });
+	state += Soup::Test::RunTest(className, "ForEachInSubtree", [&testClass]() { testClass->ForEachInSubtree(); });
+	state += Soup::Test::RunTest(className, "Erase_PrunesEmptyDirectories", [&testClass]() { testClass->Erase_PrunesEmptyDirectories(); });
+	state += Soup::Test::RunTest(className, "EraseSubtree", [&testClass]() { testClass->EraseSubtree(); });
+
+	return state;
+}
\ No newline at end of file
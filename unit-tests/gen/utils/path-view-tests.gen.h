@@ -0,0 +1,23 @@
+#pragma once
+#include "utils/path-view-tests.h"
+
+TestState RunPathViewTests() 
+ {
+	auto className = "PathViewTests";
+	auto testClass = std::make_shared<Soup::UnitTests::PathViewTests>();
+	TestState state = { 0, 0 };
+	state += Soup::Test::RunTest(className, "DefaultInitializer", [&testClass]() { testClass->DefaultInitializer(); });
+	state += Soup::Test::RunTest(className, "Initialize_Empty", [&testClass]() { testClass->Initialize_Empty(); });
+	state += Soup::Test::RunTest(className, "Initialize_UnknownRoot", [&testClass]() { testClass->Initialize_UnknownRoot(); });
+	state += Soup::Test::RunTest(className, "Initialize_RootFile", [&testClass]() { testClass->Initialize_RootFile(); });
+	state += Soup::Test::RunTest(className, "Initialize_RelativeDirectory", [&testClass]() { testClass->Initialize_RelativeDirectory(); });
+	state += Soup::Test::RunTest(className, "Promote_ToPath", [&testClass]() { testClass->Promote_ToPath(); });
+	state += Soup::Test::RunTest(className, "Path_ToView", [&testClass]() { testClass->Path_ToView(); });
+	state += Soup::Test::RunTest(className, "Literal_RootFile", [&testClass]() { testClass->Literal_RootFile(); });
+	state += Soup::Test::RunTest(className, "Literal_RelativeDirectory", [&testClass]() { testClass->Literal_RelativeDirectory(); });
+	state += Soup::Test::RunTest(className, "Literal_ToPath", [&testClass]() { testClass->Literal_ToPath(); });
+	state += Soup::Test::RunTest(className, "OperatorLessThan", [&testClass]() { testClass->OperatorLessThan(); });
+	state += Soup::Test::RunTest(className, "TryCreate", [&testClass]() { testClass->TryCreate(); });
+
+	return state;
+}
\ No newline at end of file
@@ -0,0 +1,16 @@
+#pragma once
+#include "utils/relative-path-resolver-tests.h"
+
+TestState RunRelativePathResolverTests() 
+ {
+	auto className = "RelativePathResolverTests";
+	auto testClass = std::make_shared<Soup::UnitTests::RelativePathResolverTests>();
+	TestState state = { 0, 0 };
+	state += Soup::Test::RunTest(className, "Initialize_FileBaseThrows", [&testClass]() { testClass->Initialize_FileBaseThrows(); });
+	state += Soup::Test::RunTest(className, "Resolve_SharedDirectory", [&testClass]() { testClass->Resolve_SharedDirectory(); });
+	state += Soup::Test::RunTest(className, "Resolve_UpDirectories", [&testClass]() { testClass->Resolve_UpDirectories(); });
+	state += Soup::Test::RunTest(className, "Resolve_DifferentRoot", [&testClass]() { testClass->Resolve_DifferentRoot(); });
+	state += Soup::Test::RunTest(className, "ResolveAll_MatchesGetRelativeTo", [&testClass]() { testClass->ResolveAll_MatchesGetRelativeTo(); });
+
+	return state;
+}
\ No newline at end of file
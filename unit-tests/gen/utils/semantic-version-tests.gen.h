@@ -18,6 +18,13 @@ TestState RunSemanticVersionTests()
 	state += Soup::Test::RunTest(className, "OperatorNotEqualMajor", [&testClass]() { testClass->OperatorNotEqualMajor(); });
 	state += Soup::Test::RunTest(className, "OperatorNotEqualMinor", [&testClass]() { testClass->OperatorNotEqualMinor(); });
 	state += Soup::Test::RunTest(className, "OperatorNotEqualPatch", [&testClass]() { testClass->OperatorNotEqualPatch(); });
+	state += Soup::Test::RunTest(className, "OperatorLessThanValues(\"1.2.3\", \"1.2.4\", true)", [&testClass]() { testClass->OperatorLessThanValues("1.2.3", "1.2.4", true); });
+	state += Soup::Test::RunTest(className, "OperatorLessThanValues(\"1.5.0\", \"2.0.0\", true)", [&testClass]() { testClass->OperatorLessThanValues("1.5.0", "2.0.0", true); });
+	state += Soup::Test::RunTest(className, "OperatorLessThanValues(\"2.0.0\", \"1.5.0\", false)", [&testClass]() { testClass->OperatorLessThanValues("2.0.0", "1.5.0", false); });
+	state += Soup::Test::RunTest(className, "OperatorLessThanValues(\"1.2.9\", \"1.3.0\", true)", [&testClass]() { testClass->OperatorLessThanValues("1.2.9", "1.3.0", true); });
+	state += Soup::Test::RunTest(className, "OperatorLessThanValues(\"1.3.0\", \"1.2.9\", false)", [&testClass]() { testClass->OperatorLessThanValues("1.3.0", "1.2.9", false); });
+	state += Soup::Test::RunTest(className, "OperatorLessThanValues(\"1\", \"1.0.0\", false)", [&testClass]() { testClass->OperatorLessThanValues("1", "1.0.0", false); });
+	state += Soup::Test::RunTest(className, "OperatorLessThanValues(\"1\", \"1.0.1\", true)", [&testClass]() { testClass->OperatorLessThanValues("1", "1.0.1", true); });
 	state += Soup::Test::RunTest(className, "ParseValues(\"1.2.3\", 1, 2, 3)", [&testClass]() { testClass->ParseValues("1.2.3", 1, 2, 3); });
 	state += Soup::Test::RunTest(className, "ParseValues(\"3.2.1\", 3, 2, 1)", [&testClass]() { testClass->ParseValues("3.2.1", 3, 2, 1); });
 	state += Soup::Test::RunTest(className, "ParseValues(\"1.1.1\", 1, 1, 1)", [&testClass]() { testClass->ParseValues("1.1.1", 1, 1, 1); });
@@ -33,6 +40,13 @@ TestState RunSemanticVersionTests()
 	state += Soup::Test::RunTest(className, "TryParseValues(\"1.2\", true, 1, 2, 0)", [&testClass]() { testClass->TryParseValues("1.2", true, 1, 2, 0); });
 	state += Soup::Test::RunTest(className, "ToStringValues(1, 2, 3, \"1.2.3\")", [&testClass]() { testClass->ToStringValues(1, 2, 3, "1.2.3"); });
 	state += Soup::Test::RunTest(className, "ToStringValues(0, 0, 0, \"0.0.0\")", [&testClass]() { testClass->ToStringValues(0, 0, 0, "0.0.0"); });
+	state += Soup::Test::RunTest(className, "FormatToValues(1, 2, 3, \"1.2.3\")", [&testClass]() { testClass->FormatToValues(1, 2, 3, "1.2.3"); });
+	state += Soup::Test::RunTest(className, "FormatToValues(0, 0, 0, \"0.0.0\")", [&testClass]() { testClass->FormatToValues(0, 0, 0, "0.0.0"); });
+	state += Soup::Test::RunTest(className, "FormatToValues(100, 200, 300, \"100.200.300\")", [&testClass]() { testClass->FormatToValues(100, 200, 300, "100.200.300"); });
+	state += Soup::Test::RunTest(className, "FormatTo_MissingValues", [&testClass]() { testClass->FormatTo_MissingValues(); });
+	state += Soup::Test::RunTest(className, "FormatTo_LargestValue", [&testClass]() { testClass->FormatTo_LargestValue(); });
+	state += Soup::Test::RunTest(className, "FormatTo_OutputIterator", [&testClass]() { testClass->FormatTo_OutputIterator(); });
+	state += Soup::Test::RunTest(className, "Format", [&testClass]() { testClass->Format(); });
 
 	return state;
 }
\ No newline at end of file
@@ -0,0 +1,21 @@
+#pragma once
+#include "utils/sequence-map-tests.h"
+
+TestState RunSequenceMapTests() 
+ {
+	auto className = "SequenceMapTests";
+	auto testClass = std::make_shared<Soup::UnitTests::SequenceMapTests>();
+	TestState state = { 0, 0 };
+	state += Soup::Test::RunTest(className, "Initialize", [&testClass]() { testClass->Initialize(); });
+	state += Soup::Test::RunTest(className, "Insert_Small", [&testClass]() { testClass->Insert_Small(); });
+	state += Soup::Test::RunTest(className, "Insert_Large", [&testClass]() { testClass->Insert_Large(); });
+	state += Soup::Test::RunTest(className, "Insert_Unindexed", [&testClass]() { testClass->Insert_Unindexed(); });
+	state += Soup::Test::RunTest(className, "Copy_Large", [&testClass]() { testClass->Copy_Large(); });
+	state += Soup::Test::RunTest(className, "TryGet_StringView", [&testClass]() { testClass->TryGet_StringView(); });
+	state += Soup::Test::RunTest(className, "TryEmplace", [&testClass]() { testClass->TryEmplace(); });
+	state += Soup::Test::RunTest(className, "Erase(10)", [&testClass]() { testClass->Erase(10); });
+	state += Soup::Test::RunTest(className, "Erase(100)", [&testClass]() { testClass->Erase(100); });
+	state += Soup::Test::RunTest(className, "Insert_UnhashedKey", [&testClass]() { testClass->Insert_UnhashedKey(); });
+
+	return state;
+}
\ No newline at end of file
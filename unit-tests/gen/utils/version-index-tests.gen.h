@@ -0,0 +1,19 @@
+#pragma once
+#include "utils/version-index-tests.h"
+
+TestState RunVersionIndexTests() 
+ {
+	auto className = "VersionIndexTests";
+	auto testClass = std::make_shared<Soup::UnitTests::VersionIndexTests>();
+	TestState state = { 0, 0 };
+	state += Soup::Test::RunTest(className, "Initialize", [&testClass]() { testClass->Initialize(); });
+	state += Soup::Test::RunTest(className, "Add_Sorted", [&testClass]() { testClass->Add_Sorted(); });
+	state += Soup::Test::RunTest(className, "Load_Catalog", [&testClass]() { testClass->Load_Catalog(); });
+	state += Soup::Test::RunTest(className, "Load_SemanticVersionFallback", [&testClass]() { testClass->Load_SemanticVersionFallback(); });
+	state += Soup::Test::RunTest(className, "Load_InvalidEntry", [&testClass]() { testClass->Load_InvalidEntry(); });
+	state += Soup::Test::RunTest(className, "TryGetBestMatch", [&testClass]() { testClass->TryGetBestMatch(); });
+	state += Soup::Test::RunTest(className, "TryGetLatestCompatible", [&testClass]() { testClass->TryGetLatestCompatible(); });
+	state += Soup::Test::RunTest(className, "GetRange", [&testClass]() { testClass->GetRange(); });
+
+	return state;
+}
\ No newline at end of file
@@ -0,0 +1,36 @@
+// <copyright file="mock-file-system-tests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::UnitTests
+{
+	class MockFileSystemTests
+	{
+	public:
+		// [[Fact]]
+		void Exists_MatchesCase()
+		{
+			auto uut = MockFileSystem();
+			uut.CreateMockFile(Path("C:/Src/Foo.h"), std::make_shared<MockFile>());
+
+			Assert::IsTrue(uut.Exists(Path("C:/Src/Foo.h")), "Verify exact path is found.");
+			Assert::IsFalse(uut.Exists(Path("c:/src/foo.h")), "Verify different case is not found.");
+		}
+
+		// [[Fact]]
+		void CaseInsensitive_Exists_IgnoresCase()
+		{
+			auto uut = CaseInsensitiveMockFileSystem();
+			auto file = std::make_shared<MockFile>();
+			uut.CreateMockFile(Path("C:/Src/Foo.h"), file);
+			uut.CreateMockDirectory(Path("C:/Src/"), std::make_shared<MockDirectory>(std::vector<Path>()));
+
+			Assert::IsTrue(uut.Exists(Path("c:/src/foo.h")), "Verify file is found.");
+			Assert::IsTrue(uut.Exists(Path("c:/SRC/")), "Verify directory is found.");
+			Assert::IsFalse(uut.Exists(Path("c:/src/foo.hpp")), "Verify other file is not found.");
+			Assert::IsTrue(file == uut.GetMockFile(Path("c:/src/foo.h")), "Verify file matches.");
+		}
+	};
+}
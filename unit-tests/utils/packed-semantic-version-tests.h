@@ -0,0 +1,251 @@
+// <copyright file="packed-semantic-version-tests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::UnitTests
+{
+	class PackedSemanticVersionTests
+	{
+	public:
+		// [[Fact]]
+		void DefaultInitializer()
+		{
+			auto uut = PackedSemanticVersion();
+			Assert::AreEqual(0, uut.GetMajor(), "Major version must match.");
+			Assert::IsFalse(uut.HasMinor(), "Minor version must match.");
+			Assert::IsFalse(uut.HasPatch(), "Patch version must match.");
+			Assert::AreEqual<uint64_t>(0, uut.GetValue(), "Packed value must match.");
+		}
+
+		// [[Theory]]
+		// [[InlineData(1, 2, 3)]]
+		// [[InlineData(0, 0, 0)]]
+		// [[InlineData(4194303, 1048575, 1048575)]]
+		void InitializeValues(int major, int minor, int patch)
+		{
+			auto uut = PackedSemanticVersion(major, minor, patch);
+			Assert::AreEqual(major, uut.GetMajor(), "Major version must match.");
+			Assert::AreEqual(minor, uut.GetMinor(), "Minor version must match.");
+			Assert::AreEqual(patch, uut.GetPatch(), "Patch version must match.");
+			Assert::AreEqual(
+				SemanticVersion(major, minor, patch),
+				uut.ToSemanticVersion(),
+				"Verify unpacked version matches.");
+		}
+
+		// [[Fact]]
+		void InitializeMissingValues()
+		{
+			auto uut = PackedSemanticVersion(SemanticVersion(1));
+			Assert::AreEqual(1, uut.GetMajor(), "Major version must match.");
+			Assert::IsFalse(uut.HasMinor(), "Minor version must match.");
+			Assert::IsFalse(uut.HasPatch(), "Patch version must match.");
+			Assert::AreEqual<std::string>("1", uut.ToString(), "Verify string matches.");
+
+			auto exception = Assert::Throws<std::runtime_error>([&]() {
+				auto minor = uut.GetMinor();
+			});
+			Assert::AreEqual("Semantic version does not have a minor value", exception.what(), "Verify Exception message");
+		}
+
+		// [[Fact]]
+		void TryCreate_OutOfRange()
+		{
+			auto uut = PackedSemanticVersion();
+			Assert::IsFalse(PackedSemanticVersion::TryCreate(SemanticVersion(-1, 0, 0), uut), "Verify negative major fails.");
+			Assert::IsFalse(PackedSemanticVersion::TryCreate(SemanticVersion(4194304, 0, 0), uut), "Verify large major fails.");
+			Assert::IsFalse(PackedSemanticVersion::TryCreate(SemanticVersion(1, 1048576, 0), uut), "Verify large minor fails.");
+			Assert::IsFalse(PackedSemanticVersion::TryCreate(SemanticVersion(1, 2, 1048576), uut), "Verify large patch fails.");
+			Assert::IsTrue(PackedSemanticVersion::TryCreate(SemanticVersion(1, 2, 3), uut), "Verify valid version succeeds.");
+
+			auto exception = Assert::Throws<std::runtime_error>([&]() {
+				auto version = PackedSemanticVersion(1, -2, 3);
+			});
+			Assert::AreEqual("Semantic version is out of range for a packed version", exception.what(), "Verify Exception message");
+		}
+
+		// [[Theory]]
+		// [[InlineData("1", 1, -1, -1)]]
+		// [[InlineData("1.2", 1, 2, -1)]]
+		// [[InlineData("1.2.3", 1, 2, 3)]]
+		// [[InlineData("0.0.0", 0, 0, 0)]]
+		// [[InlineData("007.10.0100", 7, 10, 100)]]
+		// [[InlineData("4194303.1048575.1048575", 4194303, 1048575, 1048575)]]
+		// [[InlineData("12345.67890.1023456", 12345, 67890, 1023456)]]
+		void TryParseValues(std::string value, int major, int minor, int patch)
+		{
+			auto uut = PackedSemanticVersion();
+			Assert::IsTrue(PackedSemanticVersion::TryParse(value, uut), "Verify parse succeeds.");
+
+			auto expected = minor < 0 ? SemanticVersion(major) :
+				patch < 0 ? SemanticVersion(major, minor) :
+				SemanticVersion(major, minor, patch);
+			Assert::AreEqual(expected, uut.ToSemanticVersion(), "Verify value matches.");
+			Assert::AreEqual(PackedSemanticVersion(expected).GetValue(), uut.GetValue(), "Verify packed value matches.");
+		}
+
+		// [[Theory]]
+		// [[InlineData("")]]
+		// [[InlineData(".")]]
+		// [[InlineData("1.")]]
+		// [[InlineData(".1")]]
+		// [[InlineData("1..2")]]
+		// [[InlineData("1.2.3.4")]]
+		// [[InlineData("-1.2.3")]]
+		// [[InlineData("+1.2.3")]]
+		// [[InlineData("1.2.3 ")]]
+		// [[InlineData("1.2.3-beta")]]
+		// [[InlineData("1.a.3")]]
+		// [[InlineData("4194304.0.0")]]
+		// [[InlineData("1.1048576.0")]]
+		// [[InlineData("1.2.1048576")]]
+		// [[InlineData("12345678.0.0")]]
+		// [[InlineData("1.2.00000003")]]
+		void TryParseInvalidValues(std::string value)
+		{
+			auto uut = PackedSemanticVersion();
+			Assert::IsFalse(PackedSemanticVersion::TryParse(value, uut), "Verify parse fails.");
+		}
+
+		// [[Fact]]
+		void Parse_Invalid()
+		{
+			auto exception = Assert::Throws<std::runtime_error>([&]() {
+				auto version = PackedSemanticVersion::Parse("1.2.x");
+			});
+			Assert::AreEqual("Invalid semantic version", exception.what(), "Verify Exception message");
+		}
+
+		// [[Fact]]
+		void ParseMany_Values()
+		{
+			auto values = std::vector<std::string_view>({ "1", "1.2", "1.2.3", "1048575.1048575.1048575" });
+			auto results = std::vector<PackedSemanticVersion>(values.size());
+			PackedSemanticVersion::ParseMany(values, results);
+
+			Assert::AreEqual<std::string>("1", results[0].ToString(), "Verify version matches.");
+			Assert::AreEqual<std::string>("1.2", results[1].ToString(), "Verify version matches.");
+			Assert::AreEqual<std::string>("1.2.3", results[2].ToString(), "Verify version matches.");
+			Assert::AreEqual<std::string>("1048575.1048575.1048575", results[3].ToString(), "Verify version matches.");
+
+			values.push_back("1.2.3.4");
+			results.push_back(PackedSemanticVersion());
+			auto exception = Assert::Throws<std::runtime_error>([&]() {
+				PackedSemanticVersion::ParseMany(values, results);
+			});
+			Assert::AreEqual("Invalid semantic version: 1.2.3.4", exception.what(), "Verify Exception message");
+
+			exception = Assert::Throws<std::runtime_error>([&]() {
+				PackedSemanticVersion::ParseMany(values, std::span<PackedSemanticVersion>(results).first(1));
+			});
+			Assert::AreEqual("The results must be the same size as the values", exception.what(), "Verify Exception message");
+		}
+
+		// [[Fact]]
+		void ParseMany_Lines()
+		{
+			auto results = std::vector<PackedSemanticVersion>();
+			PackedSemanticVersion::ParseMany("1.2.3\r\n\r\n2\n0.1\n3.4.5", results);
+
+			Assert::AreEqual<size_t>(4, results.size(), "Verify version count matches.");
+			Assert::AreEqual<std::string>("1.2.3", results[0].ToString(), "Verify version matches.");
+			Assert::AreEqual<std::string>("2", results[1].ToString(), "Verify version matches.");
+			Assert::AreEqual<std::string>("0.1", results[2].ToString(), "Verify version matches.");
+			Assert::AreEqual<std::string>("3.4.5", results[3].ToString(), "Verify version matches.");
+
+			auto exception = Assert::Throws<std::runtime_error>([&]() {
+				PackedSemanticVersion::ParseMany("1.2.3\n1.2.x\n1.2.3\n1.2.3\n1.2.3\n", results);
+			});
+			Assert::AreEqual("Invalid semantic version: 1.2.x", exception.what(), "Verify Exception message");
+		}
+
+		// [[Fact]]
+		void Comparisons_MatchSemanticVersion()
+		{
+			auto versions = std::vector<SemanticVersion>({
+				SemanticVersion(0),
+				SemanticVersion(1),
+				SemanticVersion(1, 0),
+				SemanticVersion(1, 0, 0),
+				SemanticVersion(1, 0, 1),
+				SemanticVersion(1, 5, 0),
+				SemanticVersion(1, 2, 9),
+				SemanticVersion(1, 3),
+				SemanticVersion(2, 0, 0),
+				SemanticVersion(10, 1, 1),
+			});
+
+			for (auto& left : versions)
+			{
+				for (auto& right : versions)
+				{
+					auto packedLeft = PackedSemanticVersion(left);
+					auto packedRight = PackedSemanticVersion(right);
+					Assert::AreEqual(left == right, packedLeft == packedRight, "Verify equal matches.");
+					Assert::AreEqual(left != right, packedLeft != packedRight, "Verify not equal matches.");
+					Assert::AreEqual(left < right, packedLeft < packedRight, "Verify less than matches.");
+					Assert::AreEqual(left > right, packedLeft > packedRight, "Verify greater than matches.");
+				}
+			}
+		}
+
+		// [[Fact]]
+		void Sort_Packed()
+		{
+			// Use enough versions to sort with the radix sort and keep the equal versions in their original order
+			auto versions = std::vector<SemanticVersion>();
+			for (auto i = 0; i < 1000; i++)
+			{
+				auto value = (i * 7919) % 1000;
+				if (value % 3 == 0)
+					versions.push_back(SemanticVersion(value % 5, value % 7));
+				else
+					versions.push_back(SemanticVersion(value % 5, value % 7, value % 11));
+			}
+
+			auto packed = std::vector<PackedSemanticVersion>();
+			for (auto& version : versions)
+				packed.push_back(PackedSemanticVersion(version));
+
+			std::stable_sort(versions.begin(), versions.end());
+			PackedSemanticVersion::Sort(packed);
+
+			for (auto i = 0u; i < versions.size(); i++)
+			{
+				Assert::AreEqual(
+					versions[i].ToString(),
+					packed[i].ToString(),
+					"Verify sorted version matches.");
+			}
+		}
+
+		// [[Fact]]
+		void Sort_SemanticVersions()
+		{
+			auto versions = std::vector<SemanticVersion>({
+				SemanticVersion(2, 0, 0),
+				SemanticVersion(1, 5),
+				SemanticVersion(1, 10, 2),
+				SemanticVersion(1),
+				SemanticVersion(1, 5, 1),
+			});
+
+			PackedSemanticVersion::Sort(versions);
+
+			auto expected = std::vector<SemanticVersion>({
+				SemanticVersion(1),
+				SemanticVersion(1, 5),
+				SemanticVersion(1, 5, 1),
+				SemanticVersion(1, 10, 2),
+				SemanticVersion(2, 0, 0),
+			});
+			Assert::AreEqual(expected.size(), versions.size(), "Verify version count matches.");
+			for (auto i = 0u; i < expected.size(); i++)
+			{
+				Assert::AreEqual(expected[i].ToString(), versions[i].ToString(), "Verify sorted version matches.");
+			}
+		}
+	};
+}
@@ -0,0 +1,185 @@
+// <copyright file="path-list-parser-tests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::UnitTests
+{
+	class PathListParserTests
+	{
+	public:
+		// [[Fact]]
+		void ParseLines_Empty()
+		{
+			auto paths = std::vector<Path>();
+			PathListParser::ParseLines("", paths);
+			PathListParser::ParseLines("\n\r\n  \n", paths);
+			Assert::AreEqual<size_t>(0, paths.size(), "Verify no paths.");
+		}
+
+		// [[Fact]]
+		void ParseLines_Trimmed()
+		{
+			auto paths = std::vector<Path>();
+			PathListParser::ParseLines(
+				"C:/Folder/File.txt\r\n"
+				"\r\n"
+				"  ../Up/File.txt\t\n"
+				"\"C:/Program Files/Tool.exe\"\n"
+				"C:\\Windows\\File.h",
+				paths);
+
+			Assert::AreEqual<size_t>(4, paths.size(), "Verify path count matches.");
+			Assert::AreEqual(Path("C:/Folder/File.txt"), paths[0], "Verify path matches.");
+			Assert::AreEqual(Path("../Up/File.txt"), paths[1], "Verify path matches.");
+			Assert::AreEqual(Path("C:/Program Files/Tool.exe"), paths[2], "Verify path matches.");
+			Assert::AreEqual(Path("C:/Windows/File.h"), paths[3], "Verify path matches.");
+		}
+
+		// [[Fact]]
+		void ParseLines_Appends()
+		{
+			auto paths = std::vector<Path>({
+				Path("./First.txt"),
+			});
+			PathListParser::ParseLines("Second.txt\n", paths);
+
+			Assert::AreEqual<size_t>(2, paths.size(), "Verify path count matches.");
+			Assert::AreEqual(Path("./First.txt"), paths[0], "Verify path matches.");
+			Assert::AreEqual(Path("./Second.txt"), paths[1], "Verify path matches.");
+		}
+
+		// [[Fact]]
+		void ParseDependencies_SingleLine()
+		{
+			auto paths = std::vector<Path>();
+			PathListParser::ParseDependencies("obj/Main.o: src/Main.cpp include/Main.h\n", paths);
+
+			Assert::AreEqual<size_t>(2, paths.size(), "Verify path count matches.");
+			Assert::AreEqual(Path("./src/Main.cpp"), paths[0], "Verify path matches.");
+			Assert::AreEqual(Path("./include/Main.h"), paths[1], "Verify path matches.");
+		}
+
+		// [[Fact]]
+		void ParseDependencies_LineContinuations()
+		{
+			auto paths = std::vector<Path>();
+			PathListParser::ParseDependencies(
+				"C:/Build/obj/Main.o: \\\n"
+				"  C:/Source/Main.cpp \\\n"
+				"  C:/Source/Main.h\\\r\n"
+				"  C:\\Source\\Other.h\n",
+				paths);
+
+			Assert::AreEqual<size_t>(3, paths.size(), "Verify path count matches.");
+			Assert::AreEqual(Path("C:/Source/Main.cpp"), paths[0], "Verify path matches.");
+			Assert::AreEqual(Path("C:/Source/Main.h"), paths[1], "Verify path matches.");
+			Assert::AreEqual(Path("C:/Source/Other.h"), paths[2], "Verify path matches.");
+		}
+
+		// [[Fact]]
+		void ParseDependencies_Escapes()
+		{
+			auto paths = std::vector<Path>();
+			PathListParser::ParseDependencies(
+				"Main.o: C:/Program\\ Files/SDK\\ 10/Header.h \\\n"
+				"  ./Issue\\#1/File.h ./Cost$$/File.h\n",
+				paths);
+
+			Assert::AreEqual<size_t>(3, paths.size(), "Verify path count matches.");
+			Assert::AreEqual(Path("C:/Program Files/SDK 10/Header.h"), paths[0], "Verify path matches.");
+			Assert::AreEqual(Path("./Issue#1/File.h"), paths[1], "Verify path matches.");
+			Assert::AreEqual(Path("./Cost$/File.h"), paths[2], "Verify path matches.");
+		}
+
+		// [[Fact]]
+		void ParseDependencies_MultipleRules()
+		{
+			auto paths = std::vector<Path>();
+			PathListParser::ParseDependencies(
+				"First.o Second.o: Shared.h\n"
+				"\n"
+				"Shared.h:\n"
+				"Third.o: \\\n"
+				" Third.cpp",
+				paths);
+
+			Assert::AreEqual<size_t>(2, paths.size(), "Verify path count matches.");
+			Assert::AreEqual(Path("./Shared.h"), paths[0], "Verify path matches.");
+			Assert::AreEqual(Path("./Third.cpp"), paths[1], "Verify path matches.");
+		}
+
+		// [[Fact]]
+		void ParseDependencies_Tabs()
+		{
+			auto paths = std::vector<Path>();
+			PathListParser::ParseDependencies(
+				"Main.o:\tMain.cpp\tMain.h \\\n"
+				"\tOther.h\n",
+				paths);
+
+			Assert::AreEqual<size_t>(3, paths.size(), "Verify path count matches.");
+			Assert::AreEqual(Path("./Main.cpp"), paths[0], "Verify path matches.");
+			Assert::AreEqual(Path("./Main.h"), paths[1], "Verify path matches.");
+			Assert::AreEqual(Path("./Other.h"), paths[2], "Verify path matches.");
+		}
+
+		// [[Fact]]
+		void ParseDependencies_Comments()
+		{
+			auto paths = std::vector<Path>();
+			PathListParser::ParseDependencies(
+				"# generated by: tool\n"
+				"Main.o: Main.cpp # Ignored.h\n"
+				"Other.o: Other.cpp#Ignored.h\n"
+				"Third.o: ./Issue\\#1/File.h\n",
+				paths);
+
+			Assert::AreEqual<size_t>(3, paths.size(), "Verify path count matches.");
+			Assert::AreEqual(Path("./Main.cpp"), paths[0], "Verify path matches.");
+			Assert::AreEqual(Path("./Other.cpp"), paths[1], "Verify path matches.");
+			Assert::AreEqual(Path("./Issue#1/File.h"), paths[2], "Verify path matches.");
+		}
+
+		// [[Fact]]
+		void ParseLines_Views()
+		{
+			// Every short line gains a relative prefix, which grows the buffer past the content size
+			auto buffer = std::string();
+			auto views = std::vector<PathView>();
+			PathListParser::ParseLines("a\nb\\c\nd\ne\nf/", buffer, views);
+
+			Assert::AreEqual<size_t>(5, views.size(), "Verify path count matches.");
+			Assert::AreEqual<std::string_view>("./a", views[0].ToStringView(), "Verify path matches.");
+			Assert::AreEqual<std::string_view>("./b/c", views[1].ToStringView(), "Verify path matches.");
+			Assert::AreEqual<std::string_view>("./d", views[2].ToStringView(), "Verify path matches.");
+			Assert::AreEqual<std::string_view>("./e", views[3].ToStringView(), "Verify path matches.");
+			Assert::AreEqual<std::string_view>("./f/", views[4].ToStringView(), "Verify path matches.");
+			Assert::AreEqual<std::string_view>("c", views[1].GetFileName(), "Verify file name matches.");
+			Assert::IsFalse(views[4].HasFileName(), "Verify has no file name.");
+			Assert::AreEqual<std::string>("./a./b/c./d./e./f/", buffer, "Verify buffer matches.");
+		}
+
+		// [[Fact]]
+		void ParseDependencies_Views()
+		{
+			auto buffer = std::string();
+			auto views = std::vector<PathView>({ PathView("./Stale.h") });
+			PathListParser::ParseDependencies(
+				"Main.o: C:/Source/Main.cpp \\\n"
+				" C:/Program\\ Files/SDK/Header.h include\\Main.h\n",
+				buffer,
+				views);
+
+			Assert::AreEqual<size_t>(3, views.size(), "Verify path count matches.");
+			Assert::AreEqual(Path("C:/Source/Main.cpp"), Path(views[0]), "Verify path matches.");
+			Assert::AreEqual(Path("C:/Program Files/SDK/Header.h"), Path(views[1]), "Verify path matches.");
+			Assert::AreEqual(Path("./include/Main.h"), Path(views[2]), "Verify path matches.");
+			Assert::AreEqual<std::string>(
+				"C:/Source/Main.cppC:/Program Files/SDK/Header.h./include/Main.h",
+				buffer,
+				"Verify buffer matches.");
+		}
+	};
+}
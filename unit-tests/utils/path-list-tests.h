@@ -0,0 +1,122 @@
+// <copyright file="path-list-tests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::UnitTests
+{
+	class PathListTests
+	{
+	public:
+		// [[Fact]]
+		void Empty_RoundTrip()
+		{
+			auto writer = PathListWriter();
+			auto uut = PathListReader(writer.GetData());
+			Assert::AreEqual<size_t>(0, uut.GetCount(), "Verify count matches.");
+
+			auto buffer = std::string();
+			auto views = std::vector<PathView>();
+			uut.ReadAll(buffer, views);
+			Assert::AreEqual<size_t>(0, views.size(), "Verify no views.");
+		}
+
+		// [[Fact]]
+		void ReadAll_Views()
+		{
+			auto paths = std::vector<Path>({
+				Path("C:/Folder/"),
+				Path("C:/Folder/File1.txt"),
+				Path("C:/Folder/File2.txt"),
+				Path("C:/Folder/Nested/File.txt"),
+				Path("/Root/File.txt"),
+				Path("../Up/"),
+				Path("./"),
+			});
+
+			auto writer = PathListWriter();
+			for (auto& path : paths)
+				writer.Write(path);
+
+			auto uut = PathListReader(writer.GetData());
+			Assert::AreEqual<size_t>(paths.size(), uut.GetCount(), "Verify count matches.");
+
+			auto buffer = std::string();
+			auto views = std::vector<PathView>();
+			uut.ReadAll(buffer, views);
+			Assert::AreEqual(paths.size(), views.size(), "Verify view count matches.");
+			for (auto i = 0u; i < paths.size(); i++)
+			{
+				Assert::AreEqual(paths[i].ToStringView(), views[i].ToStringView(), "Verify value matches.");
+				Assert::AreEqual(paths[i].HasRoot(), views[i].HasRoot(), "Verify has root matches.");
+				Assert::AreEqual(paths[i].HasFileName(), views[i].HasFileName(), "Verify has file name matches.");
+			}
+
+			Assert::AreEqual("C:", views[1].GetRoot(), "Verify root matches.");
+			Assert::AreEqual("File2.txt", views[2].GetFileName(), "Verify file name matches.");
+			Assert::AreEqual("Root", *std::next(views[4].GetComponents().begin()), "Verify component matches.");
+		}
+
+		// [[Fact]]
+		void ReadAll_Paths()
+		{
+			auto directory = "C:/" + std::string(200, 'a') + "/";
+			auto paths = std::vector<Path>({
+				Path(directory + "File1.txt"),
+				Path(directory + "File2.txt"),
+				Path("./File.txt"),
+			});
+
+			auto writer = PathListWriter();
+			for (auto& path : paths)
+				writer.Write(path);
+
+			auto result = std::vector<Path>();
+			PathListReader(writer.GetData()).ReadAll(result);
+			Assert::AreEqual(paths, result, "Verify paths match.");
+			Assert::AreEqual("File2.txt", result[1].GetFileName(), "Verify file name matches.");
+			Assert::AreEqual(Path(directory), result[1].GetParent(), "Verify parent matches.");
+		}
+
+		// [[Fact]]
+		void Write_SharesPrefix()
+		{
+			auto writer = PathListWriter();
+			auto directory = "C:/" + std::string(200, 'a') + "/";
+			writer.Write(Path(directory + "File1.txt"));
+			auto firstSize = writer.GetData().size();
+			writer.Write(Path(directory + "File2.txt"));
+
+			// Only the changed suffix and the locations are stored for the second path
+			Assert::AreEqual<size_t>(11, writer.GetData().size() - firstSize, "Verify shared prefix is not stored.");
+		}
+
+		// [[Fact]]
+		void Read_InvalidHeader()
+		{
+			auto exception = Assert::Throws<std::runtime_error>([&]()
+			{
+				auto uut = PathListReader("not a path list");
+			});
+			Assert::AreEqual("Path list has an invalid header", exception.what(), "Verify exception value matches.");
+		}
+
+		// [[Fact]]
+		void Read_Truncated()
+		{
+			auto writer = PathListWriter();
+			writer.Write(Path("C:/Folder/File1.txt"));
+			writer.Write(Path("C:/Folder/File2.txt"));
+			auto data = writer.GetData();
+			auto uut = PathListReader(data.substr(0, data.size() - 1));
+
+			auto exception = Assert::Throws<std::runtime_error>([&]()
+			{
+				auto result = std::vector<Path>();
+				uut.ReadAll(result);
+			});
+			Assert::AreEqual("Path list ended unexpectedly", exception.what(), "Verify exception value matches.");
+		}
+	};
+}
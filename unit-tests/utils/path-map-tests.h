@@ -0,0 +1,144 @@
+// <copyright file="path-map-tests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::UnitTests
+{
+	class PathMapTests
+	{
+	public:
+		// [[Fact]]
+		void Initialize_Default()
+		{
+			auto uut = PathMap<int>();
+			Assert::AreEqual<size_t>(0, uut.GetCount(), "Verify is empty.");
+			Assert::IsFalse(uut.Contains(Path("C:/Folder/")), "Verify missing key.");
+		}
+
+		// [[Fact]]
+		void Insert_Unique()
+		{
+			auto uut = PathMap<int>();
+			uut.Insert(Path("C:/Folder1/"), 1);
+			uut.Insert(Path("C:/Folder2/file.txt"), 2);
+
+			Assert::AreEqual<size_t>(2, uut.GetCount(), "Verify count matches.");
+			Assert::AreEqual(1, uut[Path("C:/Folder1/")], "Verify first value matches.");
+			Assert::AreEqual(2, uut[Path("C:/Folder2/file.txt")], "Verify second value matches.");
+			Assert::IsTrue(uut.Contains(PathView("C:/Folder2/file.txt")), "Verify view lookup finds key.");
+		}
+
+		// [[Fact]]
+		void TryInsert_Duplicate()
+		{
+			auto uut = PathMap<int>();
+			auto [wasInserted, value] = uut.TryInsert(Path("./Folder/"), 1);
+			Assert::IsTrue(wasInserted, "Verify first insert succeeds.");
+			Assert::AreEqual(1, *value, "Verify inserted value matches.");
+
+			auto [wasInsertedAgain, valueAgain] = uut.TryInsert(Path("./Folder/"), 2);
+			Assert::IsFalse(wasInsertedAgain, "Verify duplicate insert fails.");
+			Assert::AreEqual<size_t>(1, uut.GetCount(), "Verify count matches.");
+			Assert::AreEqual(1, uut[Path("./Folder/")], "Verify value is unchanged.");
+		}
+
+		// [[Fact]]
+		void TryGet_Missing()
+		{
+			auto uut = PathMap<int>({
+				{ Path("C:/Folder1/"), 1 },
+			});
+
+			int* value;
+			Assert::IsFalse(uut.TryGet(Path("C:/Folder2/"), value), "Verify missing key is not found.");
+			Assert::IsTrue(uut.TryGet(Path("C:/Folder1/"), value), "Verify existing key is found.");
+			Assert::AreEqual(1, *value, "Verify value matches.");
+		}
+
+		// [[Fact]]
+		void Erase_Many()
+		{
+			auto uut = PathMap<int>();
+			for (auto i = 0; i < 1000; i++)
+				uut.Insert(Path("C:/Folder" + std::to_string(i) + "/"), i);
+
+			for (auto i = 0; i < 1000; i += 2)
+				Assert::IsTrue(uut.Erase(Path("C:/Folder" + std::to_string(i) + "/")), "Verify erase succeeds.");
+
+			Assert::IsFalse(uut.Erase(Path("C:/Folder0/")), "Verify erase of missing key fails.");
+			Assert::AreEqual<size_t>(500, uut.GetCount(), "Verify count matches.");
+			for (auto i = 0; i < 1000; i++)
+			{
+				auto key = Path("C:/Folder" + std::to_string(i) + "/");
+				Assert::AreEqual(i % 2 == 1, uut.Contains(key), "Verify contains matches.");
+				if (i % 2 == 1)
+					Assert::AreEqual(i, uut[key], "Verify value matches.");
+			}
+		}
+
+		// [[Fact]]
+		void PathSet_InsertErase()
+		{
+			auto uut = PathSet({ Path("C:/Folder1/"), Path("./file.txt") });
+			Assert::IsFalse(uut.Insert(Path("C:/Folder1/")), "Verify duplicate insert fails.");
+			Assert::IsTrue(uut.Insert(Path("../Folder2/")), "Verify unique insert succeeds.");
+			Assert::AreEqual<size_t>(3, uut.GetCount(), "Verify count matches.");
+
+			Assert::IsTrue(uut.Erase(Path("C:/Folder1/")), "Verify erase succeeds.");
+			Assert::IsFalse(uut.Contains(Path("C:/Folder1/")), "Verify erased value is missing.");
+			Assert::IsTrue(uut.Contains(PathView("./file.txt")), "Verify remaining value is found.");
+			Assert::IsTrue(uut.Contains(Path("../Folder2/")), "Verify moved value is found.");
+		}
+
+		// [[Fact]]
+		void CaseInsensitive_TryGet()
+		{
+			auto uut = PathMap<int, PathCaseInsensitiveHash, PathCaseInsensitiveEqual>();
+			uut.Insert(Path("C:/Folder1/File.TXT"), 1);
+			Assert::IsFalse(uut.TryInsert(Path("c:/folder1/file.txt"), 2).first, "Verify insert with different case fails.");
+			Assert::AreEqual<size_t>(1, uut.GetCount(), "Verify count matches.");
+
+			int* value = nullptr;
+			Assert::IsTrue(uut.TryGet(PathView("C:/FOLDER1/file.Txt"), value), "Verify key with different case is found.");
+			Assert::AreEqual(1, *value, "Verify value matches.");
+			Assert::IsFalse(uut.Contains(Path("C:/Folder1/File.TX")), "Verify shorter key is missing.");
+			Assert::IsTrue(uut.Erase(Path("C:/folder1/FILE.txt")), "Verify erase with different case succeeds.");
+			Assert::AreEqual<size_t>(0, uut.GetCount(), "Verify count matches.");
+		}
+
+		// [[Fact]]
+		void CaseInsensitive_Comparers()
+		{
+			auto hash = PathCaseInsensitiveHash();
+			auto equal = PathCaseInsensitiveEqual();
+			auto less = PathCaseInsensitiveLess();
+
+			auto longValue = Path("C:/Some/Longer/Directory/Structure/To/Cover/Multiple/Blocks/File.cpp");
+			auto longLowerValue = Path("c:/some/longer/directory/structure/to/cover/multiple/blocks/file.cpp");
+			Assert::IsTrue(equal(longValue, longLowerValue), "Verify long values are equal.");
+			Assert::AreEqual(hash(longValue), hash(longLowerValue.ToView()), "Verify long value hashes match.");
+			Assert::IsFalse(equal(PathView("C:/Folder[/"), PathView("C:/Folder{/")), "Verify symbols are not folded.");
+			Assert::IsFalse(equal(PathView("C:/Folder@/"), PathView("C:/Folder`/")), "Verify symbols are not folded.");
+
+			Assert::IsFalse(less(Path("C:/ABC/"), Path("c:/abc/")), "Verify equal values are not less.");
+			Assert::IsTrue(less(Path("C:/abc/"), Path("C:/ABD/")), "Verify folded characters are compared.");
+			Assert::IsTrue(less(Path("C:/_/"), Path("C:/Z/")), "Verify letters compare as lower case.");
+			Assert::IsTrue(less(Path("C:/abc"), Path("C:/ABC/")), "Verify prefix is less.");
+		}
+
+		// [[Fact]]
+		void Comparers_UnorderedMap_PathViewLookup()
+		{
+			auto uut = std::unordered_map<Path, int, PathHash, PathEqual>();
+			uut.emplace(Path("C:/Folder1/"), 1);
+			uut.emplace(Path("./file.txt"), 2);
+
+			auto result = uut.find(PathView("./file.txt"));
+			Assert::IsTrue(result != uut.end(), "Verify view lookup is found.");
+			Assert::AreEqual(2, result->second, "Verify value matches.");
+			Assert::IsTrue(uut.find(PathView("./FILE.txt")) == uut.end(), "Verify exact lookup is case sensitive.");
+		}
+	};
+}
@@ -0,0 +1,57 @@
+// <copyright file="path-pool-tests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::UnitTests
+{
+	class PathPoolTests
+	{
+	public:
+		// [[Fact]]
+		void Initialize_Default()
+		{
+			auto uut = PathPool();
+			Assert::AreEqual<size_t>(1, uut.GetCount(), "Verify only the empty path is present.");
+			Assert::AreEqual(Path(), uut.GetPath(InternedPath()), "Verify default handle is the empty path.");
+		}
+
+		// [[Fact]]
+		void Intern_Unique()
+		{
+			auto uut = PathPool();
+			auto path1 = uut.Intern(Path("C:/Folder1/"));
+			auto path2 = uut.Intern(Path("C:/Folder2/"));
+
+			Assert::AreNotEqual(path1, path2, "Verify handles are unique.");
+			Assert::AreEqual<size_t>(3, uut.GetCount(), "Verify count matches.");
+			Assert::AreEqual(Path("C:/Folder1/"), uut.GetPath(path1), "Verify first path matches.");
+			Assert::AreEqual(Path("C:/Folder2/"), uut.GetPath(path2), "Verify second path matches.");
+		}
+
+		// [[Fact]]
+		void Intern_Duplicate()
+		{
+			auto uut = PathPool();
+			auto path1 = uut.Intern(Path("C:/Folder1/File.txt"));
+			auto path2 = uut.Intern(Path("C:/Folder1/") + Path("./File.txt"));
+
+			Assert::AreEqual(path1, path2, "Verify handles match.");
+			Assert::AreEqual<size_t>(2, uut.GetCount(), "Verify count matches.");
+			Assert::IsTrue(&uut.GetPath(path1) == &uut.GetPath(path2), "Verify the same stored value is returned.");
+		}
+
+		// [[Fact]]
+		void TryFind_Missing()
+		{
+			auto uut = PathPool();
+			uut.Intern(Path("C:/Folder1/"));
+
+			InternedPath result;
+			Assert::IsFalse(uut.TryFind(Path("C:/Folder2/"), result), "Verify missing path is not found.");
+			Assert::IsTrue(uut.TryFind(Path("C:/Folder1/"), result), "Verify existing path is found.");
+			Assert::AreEqual(Path("C:/Folder1/"), uut.GetPath(result), "Verify found path matches.");
+		}
+	};
+}
@@ -111,6 +111,24 @@ namespace Soup::UnitTests
 			Assert::AreEqual("C:/myfolder/anotherfolder/file.txt", uut.ToString(), "Verify string value matches.");
 		}
 
+		// [[Fact]]
+		void Initialize_LongPath()
+		{
+			auto value = std::string("C:/");
+			for (auto i = 0; i < 20; i++)
+				value.append("LongFolderName/");
+			value.append("file.txt");
+
+			auto uut = Path(value);
+			Assert::IsTrue(uut.HasRoot(), "Verify is root.");
+			Assert::AreEqual("C:", uut.GetRoot(), "Verify root matches.");
+			Assert::AreEqual("file.txt", uut.GetFileName(), "Verify file name matches.");
+			Assert::AreEqual(value, uut.ToString(), "Verify string value matches.");
+
+			auto copy = uut;
+			Assert::AreEqual(uut, copy, "Verify copy matches.");
+		}
+
 		// [[Fact]]
 		void Parse_AlternativeDirectoriesPath()
 		{
@@ -126,6 +144,46 @@ namespace Soup::UnitTests
 			Assert::AreEqual("C:/myfolder/anotherfolder/file.txt", uut.ToString(), "Verify string value matches.");
 		}
 
+		// [[Fact]]
+		void Parse_LongAlternativeDirectoriesPath()
+		{
+			auto value = std::string("C:");
+			auto expected = std::string("C:");
+			for (auto i = 0; i < 20; i++)
+			{
+				value.append(i % 3 == 0 ? "/" : "\\");
+				value.append("LongFolderName");
+				expected.append("/LongFolderName");
+			}
+			value.append("\\file.txt");
+			expected.append("/file.txt");
+
+			auto uut = Path::Parse(value);
+			Assert::AreEqual("C:", uut.GetRoot(), "Verify root matches.");
+			Assert::AreEqual("file.txt", uut.GetFileName(), "Verify file name matches.");
+			Assert::AreEqual(expected, uut.ToString(), "Verify string value matches.");
+		}
+
+		// [[Fact]]
+		void CreateWindows_LongPath()
+		{
+			auto value = std::string("C:\\");
+			auto expected = std::string("C:/");
+			for (auto i = 0; i < 20; i++)
+			{
+				value.append("LongFolderName\\");
+				expected.append("LongFolderName/");
+			}
+			value.append("file.txt");
+			expected.append("file.txt");
+
+			auto uut = Path::CreateWindows(value);
+			Assert::AreEqual("C:", uut.GetRoot(), "Verify root matches.");
+			Assert::AreEqual("file.txt", uut.GetFileName(), "Verify file name matches.");
+			Assert::AreEqual(expected, uut.ToString(), "Verify string value matches.");
+			Assert::AreEqual(value, uut.ToAlternateString(), "Verify alternate string value matches.");
+		}
+
 		// [[Fact]]
 		void Parse_RemoveEmptyDirectoryInside()
 		{
@@ -223,6 +281,20 @@ namespace Soup::UnitTests
 			Assert::AreEqual("C:/MyFolder/", uut.ToString(), "Verify value matches.");
 		}
 	
+		// [[Fact]]
+		void Concatenate_LongPath()
+		{
+			auto path1 = Path("C:/AVeryLongRootFolderNameThatTakesUpSpace/AnotherVeryLongFolderNameThatTakesUpSpace/");
+			auto path2 = Path("./AThirdVeryLongFolderNameThatTakesUpSpace/MyFile.txt");
+			auto uut = path1 + path2;
+
+			Assert::AreEqual(
+				"C:/AVeryLongRootFolderNameThatTakesUpSpace/AnotherVeryLongFolderNameThatTakesUpSpace/AThirdVeryLongFolderNameThatTakesUpSpace/MyFile.txt",
+				uut.ToString(),
+				"Verify value matches.");
+			Assert::AreEqual("MyFile.txt", uut.GetFileName(), "Verify file name matches.");
+		}
+	
 		// [[Fact]]
 		void Concatenate_UpDirectory()
 		{
@@ -233,6 +305,28 @@ namespace Soup::UnitTests
 			Assert::AreEqual("C:/NewRoot/MyFile.txt", uut.ToString(), "Verify value matches.");
 		}
 
+		// [[Fact]]
+		void Concatenate_MultipleUpDirectory()
+		{
+			auto path1 = Path("C:/Folder1/Folder2/Folder3/");
+			auto path2 = Path("../../NewFolder/../NewRoot/MyFile.txt");
+			auto uut = path1 + path2;
+
+			Assert::AreEqual("C:/Folder1/NewRoot/MyFile.txt", uut.ToString(), "Verify value matches.");
+			Assert::AreEqual("MyFile.txt", uut.GetFileName(), "Verify file name matches.");
+		}
+
+		// [[Fact]]
+		void Concatenate_UpDirectoryRelative()
+		{
+			auto path1 = Path("./Folder1/");
+			auto path2 = Path("../../Other/");
+			auto uut = path1 + path2;
+
+			Assert::AreEqual("../Other/", uut.ToString(), "Verify value matches.");
+			Assert::IsFalse(uut.HasFileName(), "Verify has no file name.");
+		}
+
 		// [[Fact]]
 		void Concatenate_TwoRelative()
 		{
@@ -280,6 +374,232 @@ namespace Soup::UnitTests
 			Assert::AreEqual("../MyFile.awe", uut.ToString(), "Verify value matches.");
 		}
 
+		// [[Fact]]
+		void SetFileExtension_LongPath()
+		{
+			auto directory = "C:/" + std::string(200, 'a') + "/";
+			auto uut = Path(directory + "MyFile.txt");
+			auto data = uut.ToStringView().data();
+			uut.SetFileExtension("h");
+
+			Assert::AreEqual(directory + "MyFile.h", uut.ToString(), "Verify value matches.");
+			Assert::AreEqual(".h", uut.GetFileExtension(), "Verify file extension matches.");
+			Assert::IsTrue(uut.ToStringView().data() == data, "Verify value is updated in place.");
+		}
+
+		// [[Fact]]
+		void SetFilename_MemoryResource()
+		{
+			auto arena = std::pmr::monotonic_buffer_resource();
+			auto directory = "C:/" + std::string(200, 'a') + "/";
+			auto uut = Path(directory + "File.txt", &arena);
+			uut.SetFilename("A" + std::string(100, 'b') + ".txt");
+
+			Assert::AreEqual(directory + "A" + std::string(100, 'b') + ".txt", uut.ToString(), "Verify value matches.");
+			Assert::IsTrue(uut.GetMemoryResource() == &arena, "Verify resource is unchanged.");
+		}
+
+		// [[Fact]]
+		void SetFilename_OwnValue()
+		{
+			auto uut = Path("C:/Folder/File.txt");
+			uut.SetFilename(uut.GetFileStem());
+			Assert::AreEqual("C:/Folder/File", uut.ToString(), "Verify value matches.");
+
+			uut.SetFileExtension(uut.ToStringView().substr(3, 6));
+			Assert::AreEqual("C:/Folder/File.Folder", uut.ToString(), "Verify value matches.");
+		}
+
+		// [[Fact]]
+		void SetFilename_EmptyDirectories()
+		{
+			auto uut = Path("C:/a//b/c.txt");
+			uut.SetFilename("x.o");
+			Assert::AreEqual("C:/a/b/x.o", uut.ToString(), "Verify value matches.");
+			Assert::AreEqual("x.o", uut.GetFileName(), "Verify file name matches.");
+
+			uut = Path("C:/a//b/c.txt");
+			uut.SetFileExtension("h");
+			Assert::AreEqual("C:/a/b/c.h", uut.ToString(), "Verify value matches.");
+			Assert::AreEqual("c.h", uut.GetFileName(), "Verify file name matches.");
+		}
+
+		// [[Fact]]
+		void GetParent_File()
+		{
+			auto uut = Path("C:/Folder1/File.txt");
+			auto result = uut.GetParent();
+
+			Assert::AreEqual("C:/Folder1/", result.ToString(), "Verify result matches.");
+			Assert::IsFalse(result.HasFileName(), "Verify has no file name.");
+		}
+
+		// [[Fact]]
+		void GetParent_Directory()
+		{
+			auto uut = Path("C:/Folder1/Folder2/");
+			auto result = uut.GetParent();
+
+			Assert::AreEqual("C:/Folder1/", result.ToString(), "Verify result matches.");
+			Assert::AreEqual("C:/", result.GetParent().ToString(), "Verify root result matches.");
+			Assert::AreEqual("C:/", result.GetParent().GetParent().ToString(), "Verify root parent result matches.");
+		}
+
+		// [[Fact]]
+		void GetParent_Relative()
+		{
+			auto uut = Path("./Folder1/");
+			auto result = uut.GetParent();
+
+			Assert::AreEqual("./", result.ToString(), "Verify result matches.");
+			Assert::AreEqual("../", result.GetParent().ToString(), "Verify up result matches.");
+			Assert::AreEqual("../../", result.GetParent().GetParent().ToString(), "Verify up up result matches.");
+		}
+
+		// [[Theory]]
+		// [[InlineData("./a//b/", "./a/")]]
+		// [[InlineData("C:/a//b/", "C:/a/")]]
+		// [[InlineData("C:/a//b/c/", "C:/a/b/")]]
+		// [[InlineData("C://a/", "C:/")]]
+		// [[InlineData("//a/", "/")]]
+		// [[InlineData("C:/a//b/c.txt", "C:/a//b/")]]
+		void GetParent_EmptyDirectories(std::string value, std::string expected)
+		{
+			auto uut = Path(value);
+			auto result = uut.GetParent();
+
+			Assert::AreEqual(expected, result.ToString(), "Verify result matches.");
+			Assert::IsFalse(result.HasFileName(), "Verify has no file name.");
+		}
+
+		// [[Fact]]
+		void GetComponents_Rooted()
+		{
+			auto uut = Path("C:/Folder1/Folder2/File.txt");
+			auto components = std::vector<std::string_view>();
+			for (auto component : uut.GetComponents())
+				components.push_back(component);
+
+			auto expected = std::vector<std::string_view>({ "C:", "Folder1", "Folder2", "File.txt" });
+			Assert::AreEqual(expected, components, "Verify forward components match.");
+
+			auto reverseComponents = std::vector<std::string_view>();
+			auto range = uut.GetComponents();
+			for (auto component = range.end(); component != range.begin();)
+				reverseComponents.push_back(*--component);
+
+			auto expectedReverse = std::vector<std::string_view>({ "File.txt", "Folder2", "Folder1", "C:" });
+			Assert::AreEqual(expectedReverse, reverseComponents, "Verify reverse components match.");
+		}
+
+		// [[Fact]]
+		void GetComponents_Relative()
+		{
+			auto uut = Path("../Folder1/");
+			auto components = std::vector<std::string_view>();
+			for (auto component : uut.GetComponents())
+				components.push_back(component);
+
+			auto expected = std::vector<std::string_view>({ "..", "Folder1" });
+			Assert::AreEqual(expected, components, "Verify components match.");
+		}
+
+		// [[Fact]]
+		void GetComponent_Rooted()
+		{
+			auto uut = Path("C:/Folder1/Folder2/File.txt");
+			Assert::AreEqual<size_t>(2, uut.GetDepth(), "Verify depth matches.");
+			Assert::AreEqual("Folder2", uut.GetComponent(2), "Verify component matches.");
+
+			uut.BuildComponentIndex();
+			Assert::IsTrue(uut.HasComponentIndex(), "Verify has component index.");
+			Assert::AreEqual<size_t>(2, uut.GetDepth(), "Verify indexed depth matches.");
+			Assert::AreEqual("C:", uut.GetComponent(0), "Verify root matches.");
+			Assert::AreEqual("Folder1", uut.GetComponent(1), "Verify directory matches.");
+			Assert::AreEqual("Folder2", uut.GetComponent(2), "Verify directory matches.");
+			Assert::AreEqual("File.txt", uut.GetComponent(3), "Verify file name matches.");
+
+			auto exception = Assert::Throws<std::runtime_error>([&]()
+			{
+				uut.GetComponent(4);
+			});
+			Assert::AreEqual("Component index is past the end of the path", exception.what(), "Verify exception value matches.");
+		}
+
+		// [[Fact]]
+		void GetComponent_Relative()
+		{
+			auto uut = Path("../Folder1/");
+			uut.BuildComponentIndex();
+			Assert::AreEqual<size_t>(2, uut.GetDepth(), "Verify depth matches.");
+			Assert::AreEqual("..", uut.GetComponent(0), "Verify directory matches.");
+			Assert::AreEqual("Folder1", uut.GetComponent(1), "Verify directory matches.");
+		}
+
+		// [[Fact]]
+		void BuildComponentIndex_TooDeep()
+		{
+			auto uut = Path("C:/1/2/3/4/5/6/7/8/9/10/11/12/File.txt");
+			uut.BuildComponentIndex();
+			Assert::IsFalse(uut.HasComponentIndex(), "Verify deep path is not indexed.");
+			Assert::AreEqual<size_t>(12, uut.GetDepth(), "Verify depth matches.");
+			Assert::AreEqual("12", uut.GetComponent(12), "Verify directory matches.");
+		}
+
+		// [[Fact]]
+		void CommonPrefixLength()
+		{
+			auto uut = Path("C:/Folder1/Folder2/File.txt");
+			auto other = Path("C:/Folder1/Folder23/");
+			Assert::AreEqual<size_t>(2, uut.CommonPrefixLength(other), "Verify common prefix matches.");
+			Assert::AreEqual<size_t>(0, uut.CommonPrefixLength(Path("D:/Folder1/")), "Verify different root matches.");
+			Assert::AreEqual<size_t>(0, uut.CommonPrefixLength(Path("./Folder1/")), "Verify relative matches.");
+			Assert::AreEqual<size_t>(3, uut.CommonPrefixLength(Path("C:/Folder1/Folder2/Other.txt")), "Verify file names are ignored.");
+
+			uut.BuildComponentIndex();
+			other.BuildComponentIndex();
+			Assert::AreEqual<size_t>(2, uut.CommonPrefixLength(other), "Verify indexed common prefix matches.");
+			Assert::AreEqual<size_t>(2, other.CommonPrefixLength(uut), "Verify indexed common prefix matches.");
+		}
+
+		// [[Fact]]
+		void GetParent_ComponentIndex()
+		{
+			auto uut = Path("C:/Folder1/Folder2/File.txt");
+			uut.BuildComponentIndex();
+
+			auto parent = uut.GetParent().GetParent();
+			Assert::AreEqual("C:/Folder1/", parent.ToString(), "Verify parent matches.");
+			Assert::IsTrue(parent.HasComponentIndex(), "Verify parent has component index.");
+			Assert::AreEqual<size_t>(1, parent.GetDepth(), "Verify depth matches.");
+			Assert::AreEqual("Folder1", parent.GetComponent(1), "Verify directory matches.");
+		}
+
+		// [[Theory]]
+		// [[InlineData("C:/a/bb/ccc/dddd/File.txt")]]
+		// [[InlineData("/a/bb/ccc/")]]
+		// [[InlineData("./a/bb/")]]
+		void GetParent_ComponentIndex_WalkToRoot(std::string value)
+		{
+			// Walk an indexed path and a path without an index up to the root, which is the relative
+			// directory for a relative path
+			auto current = Path(value);
+			current.BuildComponentIndex();
+			auto expected = Path(value);
+			auto rootDepth = current.HasRoot() ? 0u : 1u;
+			while (current.GetDepth() > rootDepth || current.HasFileName())
+			{
+				current = current.GetParent();
+				expected = expected.GetParent();
+
+				Assert::AreEqual(expected.ToString(), current.ToString(), "Verify parent matches.");
+				Assert::IsTrue(current.HasComponentIndex(), "Verify parent has component index.");
+				Assert::AreEqual(expected.GetDepth(), current.GetDepth(), "Verify depth matches.");
+			}
+
+			Assert::AreEqual<size_t>(rootDepth, current.GetDepth(), "Verify root depth matches.");
+		}
+
 		// [[Fact]]
 		void GetRelativeTo_Empty()
 		{
@@ -324,6 +644,18 @@ namespace Soup::UnitTests
 			Assert::AreEqual("../Folder1/File.txt", result.ToString(), "Verify result matches.");
 		}
 
+		// [[Fact]]
+		void GetRelativeTo_Directory()
+		{
+			auto uut = Path("C:/Folder1/Folder2/");
+			auto base = Path("C:/Folder1/Folder3/");
+
+			auto result = uut.GetRelativeTo(base);
+
+			Assert::AreEqual("../Folder2/", result.ToString(), "Verify result matches.");
+			Assert::IsFalse(result.HasFileName(), "Verify has no file name.");
+		}
+
 		// [[Fact]]
 		void GetRelativeTo_Rooted_DifferentRoot()
 		{
@@ -345,5 +677,142 @@ namespace Soup::UnitTests
 
 			Assert::AreEqual("./File.txt", result.ToString(), "Verify result matches.");
 		}
+
+		// [[Fact]]
+		void GetHash_Equal()
+		{
+			auto uut = Path("C:/Folder1/File.txt");
+			auto other = Path("C:/Folder1/") + Path("./File.txt");
+
+			Assert::AreEqual(uut.GetHash(), other.GetHash(), "Verify equal paths have equal hashes.");
+			Assert::AreEqual(uut.GetHash(), uut.ToView().GetHash(), "Verify view hash matches.");
+			Assert::AreEqual(uut.GetHash(), std::hash<Path>()(uut), "Verify std hash matches.");
+		}
+
+		// [[Fact]]
+		void GetHash_Modified()
+		{
+			auto uut = Path("C:/Folder1/File.txt");
+			auto original = uut.GetHash();
+			uut.SetFilename("Other.txt");
+
+			Assert::AreNotEqual(original, uut.GetHash(), "Verify hash changes with the value.");
+			Assert::AreEqual(Path("C:/Folder1/Other.txt").GetHash(), uut.GetHash(), "Verify hash matches new value.");
+		}
+
+		// [[Fact]]
+		void Parse_MemoryResource()
+		{
+			auto buffer = std::array<char, 1024>();
+			auto arena = std::pmr::monotonic_buffer_resource(buffer.data(), buffer.size());
+			auto value = std::string("C:/") + std::string(200, 'a') + "/../File.txt";
+			auto uut = Path::Parse(value, &arena);
+
+			Assert::AreEqual("C:/File.txt", uut.ToString(), "Verify value matches.");
+			Assert::IsTrue(uut.GetMemoryResource() == &arena, "Verify resource matches.");
+		}
+
+		// [[Fact]]
+		void Concatenate_MemoryResource()
+		{
+			auto buffer = std::array<char, 1024>();
+			auto arena = std::pmr::monotonic_buffer_resource(buffer.data(), buffer.size());
+			auto directory = Path("C:/" + std::string(200, 'a') + "/", &arena);
+			auto uut = directory + Path("./File.txt");
+
+			// Long values spill into the arena instead of the heap
+			auto data = uut.ToStringView().data();
+			Assert::IsTrue(uut.GetMemoryResource() == &arena, "Verify resource matches.");
+			Assert::IsTrue(data >= buffer.data() && data < buffer.data() + buffer.size(), "Verify value is in the arena.");
+			Assert::IsTrue(uut.GetParent().GetMemoryResource() == &arena, "Verify parent resource matches.");
+			Assert::IsTrue(
+				uut.GetRelativeTo(Path("C:/")).GetMemoryResource() == &arena,
+				"Verify relative resource matches.");
+		}
+
+		// [[Fact]]
+		void Copy_MemoryResource()
+		{
+			auto arena = std::pmr::monotonic_buffer_resource();
+			auto original = Path("C:/" + std::string(200, 'a') + "/File.txt", &arena);
+			auto uut = original;
+
+			Assert::AreEqual(original, uut, "Verify value matches.");
+			Assert::IsTrue(uut.GetMemoryResource() == nullptr, "Verify copy uses the heap.");
+
+			uut = std::move(original);
+			Assert::IsTrue(uut.GetMemoryResource() == nullptr, "Verify move assignment keeps the heap.");
+		}
+
+		// [[Fact]]
+		void Copy_SharesLongValue()
+		{
+			auto original = Path("C:/" + std::string(200, 'a') + "/File.txt");
+			auto uut = original;
+
+			Assert::AreEqual(original, uut, "Verify value matches.");
+			Assert::IsTrue(
+				original.ToStringView().data() == uut.ToStringView().data(),
+				"Verify copy shares the long value.");
+		}
+
+		// [[Fact]]
+		void SetFilename_DetachesSharedCopy()
+		{
+			auto directory = "C:/" + std::string(200, 'a') + "/";
+			auto original = Path(directory + "File.txt");
+			auto uut = original;
+			uut.SetFilename("Other.txt");
+
+			Assert::AreEqual(directory + "File.txt", original.ToString(), "Verify original is unchanged.");
+			Assert::AreEqual(directory + "Other.txt", uut.ToString(), "Verify copy is updated.");
+		}
+
+		// [[Fact]]
+		void TryCreate_Valid()
+		{
+			auto uut = Path();
+			Assert::IsTrue(Path::TryCreate("C:/Folder/File.txt", uut), "Verify create succeeds.");
+			Assert::AreEqual(Path("C:/Folder/File.txt"), uut, "Verify value matches.");
+			Assert::AreEqual("C:", uut.GetRoot(), "Verify root matches.");
+			Assert::AreEqual("File.txt", uut.GetFileName(), "Verify file name matches.");
+		}
+
+		// [[Fact]]
+		void TryCreate_Invalid()
+		{
+			auto uut = Path("./File.txt");
+			Assert::IsFalse(Path::TryCreate("", uut), "Verify missing separator fails.");
+			Assert::IsFalse(Path::TryCreate("File.txt", uut), "Verify missing separator fails.");
+			Assert::IsFalse(Path::TryCreate("Folder/File.txt", uut), "Verify unknown root fails.");
+			Assert::AreEqual(Path("./File.txt"), uut, "Verify result is unchanged.");
+		}
+
+		// [[Fact]]
+		void TryCreate_MemoryResource()
+		{
+			auto arena = std::pmr::monotonic_buffer_resource();
+			auto uut = Path("./", &arena);
+			Assert::IsTrue(Path::TryCreate("C:/" + std::string(200, 'a') + "/File.txt", uut), "Verify create succeeds.");
+			Assert::IsTrue(uut.GetMemoryResource() == &arena, "Verify resource is unchanged.");
+			Assert::AreEqual("File.txt", uut.GetFileName(), "Verify file name matches.");
+		}
+
+		// [[Fact]]
+		void TryGetRoot_TryGetFileName()
+		{
+			// The views reference the path storage, so keep the paths alive while checking them
+			auto rooted = Path("C:/Folder/File.txt");
+			auto relative = Path("./Folder/");
+			auto value = std::string_view();
+			Assert::IsTrue(rooted.TryGetRoot(value), "Verify root is found.");
+			Assert::AreEqual("C:", value, "Verify root matches.");
+			Assert::IsTrue(rooted.TryGetFileName(value), "Verify file name is found.");
+			Assert::AreEqual("File.txt", value, "Verify file name matches.");
+
+			Assert::IsFalse(relative.TryGetRoot(value), "Verify missing root fails.");
+			Assert::IsFalse(relative.TryGetFileName(value), "Verify missing file name fails.");
+			Assert::AreEqual("File.txt", value, "Verify value is unchanged.");
+		}
 	};
 }
@@ -0,0 +1,130 @@
+// <copyright file="path-trie-tests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::UnitTests
+{
+	class PathTrieTests
+	{
+	public:
+		// [[Fact]]
+		void Initialize_Default()
+		{
+			auto uut = PathTrie<int>();
+			Assert::AreEqual<size_t>(0, uut.GetCount(), "Verify is empty.");
+			Assert::IsFalse(uut.Contains(Path("C:/Folder/")), "Verify missing key.");
+		}
+
+		// [[Fact]]
+		void Insert_SharedPrefix()
+		{
+			auto uut = PathTrie<int>();
+			uut.Insert(Path("C:/Folder/"), 1);
+			uut.Insert(Path("C:/Folder/File.txt"), 2);
+			uut.Insert(Path("C:/Other/File.txt"), 3);
+
+			Assert::AreEqual<size_t>(3, uut.GetCount(), "Verify count matches.");
+			Assert::IsTrue(uut.Contains(Path("C:/Folder/")), "Verify directory key found.");
+			Assert::IsFalse(uut.Contains(Path("C:/")), "Verify intermediate directory is not a key.");
+
+			int* value;
+			Assert::IsTrue(uut.TryGet(Path("C:/Other/File.txt"), value), "Verify file key found.");
+			Assert::AreEqual(3, *value, "Verify value matches.");
+		}
+
+		// [[Fact]]
+		void TryInsert_Duplicate()
+		{
+			auto uut = PathTrie<int>();
+			auto [wasInserted, value] = uut.TryInsert(Path("./Folder/"), 1);
+			Assert::IsTrue(wasInserted, "Verify first insert succeeds.");
+			Assert::AreEqual(1, *value, "Verify inserted value matches.");
+
+			auto [wasInsertedAgain, valueAgain] = uut.TryInsert(Path("./Folder/"), 2);
+			Assert::IsFalse(wasInsertedAgain, "Verify duplicate insert fails.");
+			Assert::AreEqual<size_t>(1, uut.GetCount(), "Verify count matches.");
+		}
+
+		// [[Fact]]
+		void TryGetLongestPrefix()
+		{
+			auto uut = PathTrie<int>();
+			uut.Insert(Path("C:/Root/"), 1);
+			uut.Insert(Path("C:/Root/Packages/"), 2);
+
+			const int* value;
+			Assert::IsTrue(
+				uut.TryGetLongestPrefix(Path("C:/Root/Packages/Sub/File.txt"), value),
+				"Verify nested prefix found.");
+			Assert::AreEqual(2, *value, "Verify closest value matches.");
+
+			Assert::IsTrue(uut.TryGetLongestPrefix(Path("C:/Root/Other/"), value), "Verify outer prefix found.");
+			Assert::AreEqual(1, *value, "Verify outer value matches.");
+
+			Assert::IsTrue(uut.TryGetLongestPrefix(Path("C:/Root/"), value), "Verify exact key is a prefix.");
+			Assert::AreEqual(1, *value, "Verify exact value matches.");
+
+			Assert::IsFalse(uut.TryGetLongestPrefix(Path("D:/Root/"), value), "Verify no prefix on other root.");
+			Assert::IsFalse(uut.TryGetLongestPrefix(Path("C:/RootFolder/"), value), "Verify partial names do not match.");
+		}
+
+		// [[Fact]]
+		void ForEachInSubtree()
+		{
+			auto uut = PathTrie<int>();
+			uut.Insert(Path("C:/Root/"), 1);
+			uut.Insert(Path("C:/Root/Folder/File.txt"), 2);
+			uut.Insert(Path("C:/Root/File.txt"), 3);
+			uut.Insert(Path("C:/Other/File.txt"), 4);
+
+			auto result = std::map<std::string, int>();
+			uut.ForEachInSubtree(Path("C:/Root/"), [&](PathView key, int& value)
+			{
+				result.emplace(key.ToString(), value);
+			});
+
+			auto expected = std::map<std::string, int>({
+				{ "C:/Root/", 1 },
+				{ "C:/Root/Folder/File.txt", 2 },
+				{ "C:/Root/File.txt", 3 },
+			});
+			Assert::IsTrue(expected == result, "Verify subtree matches.");
+		}
+
+		// [[Fact]]
+		void Erase_PrunesEmptyDirectories()
+		{
+			auto uut = PathTrie<int>();
+			uut.Insert(Path("C:/Root/Folder/File.txt"), 1);
+			uut.Insert(Path("C:/Root/"), 2);
+
+			Assert::IsTrue(uut.Erase(Path("C:/Root/Folder/File.txt")), "Verify erase succeeds.");
+			Assert::IsFalse(uut.Erase(Path("C:/Root/Folder/")), "Verify intermediate directory is not a key.");
+			Assert::AreEqual<size_t>(1, uut.GetCount(), "Verify count matches.");
+
+			size_t visited = 0;
+			uut.ForEachInSubtree(Path("C:/"), [&](PathView key, int& value) { visited++; });
+			Assert::AreEqual<size_t>(1, visited, "Verify only the remaining value is visited.");
+		}
+
+		// [[Fact]]
+		void EraseSubtree()
+		{
+			auto uut = PathTrie<int>();
+			uut.Insert(Path("C:/Root/"), 1);
+			uut.Insert(Path("C:/Root/Folder/File.txt"), 2);
+			uut.Insert(Path("C:/Root/File.txt"), 3);
+			uut.Insert(Path("C:/Other/File.txt"), 4);
+
+			Assert::AreEqual<size_t>(3, uut.EraseSubtree(Path("C:/Root/")), "Verify erased count matches.");
+			Assert::AreEqual<size_t>(1, uut.GetCount(), "Verify count matches.");
+			Assert::IsFalse(uut.Contains(Path("C:/Root/File.txt")), "Verify subtree value removed.");
+			Assert::IsTrue(uut.Contains(Path("C:/Other/File.txt")), "Verify other value remains.");
+
+			uut.Insert(Path("C:/Root/File.txt"), 5);
+			Assert::IsTrue(uut.Contains(Path("C:/Root/File.txt")), "Verify reinsert after erase.");
+		}
+	};
+}
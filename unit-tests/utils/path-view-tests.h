@@ -0,0 +1,146 @@
+// <copyright file="path-view-tests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::UnitTests
+{
+	class PathViewTests
+	{
+	public:
+		// [[Fact]]
+		void DefaultInitializer()
+		{
+			auto uut = PathView();
+			Assert::IsTrue(uut.IsEmpty(), "Verify is empty.");
+			Assert::IsFalse(uut.HasRoot(), "Verify has no root.");
+			Assert::IsFalse(uut.HasFileName(), "Verify has no file name.");
+			Assert::AreEqual("./", uut.ToStringView(), "Verify string value matches.");
+		}
+
+		// [[Fact]]
+		void Initialize_Empty()
+		{
+			auto exception = Assert::Throws<std::runtime_error>([&]()
+			{
+				auto uut = PathView("");
+			});
+			Assert::AreEqual("A path must have a directory separator", exception.what(), "Verify exception value matches.");
+		}
+
+		// [[Fact]]
+		void Initialize_UnknownRoot()
+		{
+			auto exception = Assert::Throws<std::runtime_error>([&]()
+			{
+				auto uut = PathView("Folder/file.txt");
+			});
+			Assert::AreEqual("Unknown directory root Folder", exception.what(), "Verify exception value matches.");
+		}
+
+		// [[Fact]]
+		void Initialize_RootFile()
+		{
+			auto value = std::string("C:/Folder/file.txt");
+			auto uut = PathView(value);
+			Assert::IsTrue(uut.HasRoot(), "Verify has root.");
+			Assert::AreEqual("C:", uut.GetRoot(), "Verify root matches.");
+			Assert::IsTrue(uut.HasFileName(), "Verify has file name.");
+			Assert::AreEqual("file.txt", uut.GetFileName(), "Verify file name matches.");
+			Assert::AreEqual("file", uut.GetFileStem(), "Verify file stem matches.");
+			Assert::AreEqual(".txt", uut.GetFileExtension(), "Verify file extension matches.");
+			Assert::IsTrue(uut.ToStringView().data() == value.data(), "Verify the view references the original value.");
+		}
+
+		// [[Fact]]
+		void Initialize_RelativeDirectory()
+		{
+			auto uut = PathView("../Folder/");
+			Assert::IsFalse(uut.HasRoot(), "Verify has no root.");
+			Assert::IsFalse(uut.HasFileName(), "Verify has no file name.");
+			Assert::IsFalse(uut.HasFileExtension(), "Verify has no file extension.");
+
+			auto components = std::vector<std::string_view>(uut.GetComponents().begin(), uut.GetComponents().end());
+			Assert::AreEqual(std::vector<std::string_view>({ "..", "Folder" }), components, "Verify components match.");
+		}
+
+		// [[Fact]]
+		void Promote_ToPath()
+		{
+			auto uut = PathView("C:/Folder/file.txt");
+			auto path = Path(uut);
+			Assert::AreEqual(Path("C:/Folder/file.txt"), path, "Verify path matches.");
+			Assert::AreEqual("C:", path.GetRoot(), "Verify root matches.");
+			Assert::AreEqual("file.txt", path.GetFileName(), "Verify file name matches.");
+			Assert::IsTrue(path.ToStringView().data() != uut.ToStringView().data(), "Verify the path owns a copy.");
+		}
+
+		// [[Fact]]
+		void Path_ToView()
+		{
+			auto path = Path("./Folder/file.txt");
+			auto uut = path.ToView();
+			Assert::IsTrue(uut == PathView("./Folder/file.txt"), "Verify view matches.");
+			Assert::AreEqual("file.txt", uut.GetFileName(), "Verify file name matches.");
+			Assert::IsTrue(uut.ToStringView().data() == path.ToStringView().data(), "Verify the view references the path.");
+		}
+
+		// [[Fact]]
+		void Literal_RootFile()
+		{
+			constexpr auto uut = "C:/Folder/file.txt"_path;
+			static_assert(uut.HasRoot());
+			static_assert(uut.GetRoot() == "C:");
+			static_assert(uut.GetFileName() == "file.txt");
+			static_assert(uut.GetFileExtension() == ".txt");
+
+			Assert::AreEqual(PathView("C:/Folder/file.txt").GetFileName(), uut.GetFileName(), "Verify file name matches parsed view.");
+		}
+
+		// [[Fact]]
+		void Literal_RelativeDirectory()
+		{
+			constexpr auto uut = "../../Folder/"_path;
+			static_assert(!uut.HasRoot());
+			static_assert(!uut.HasFileName());
+
+			auto components = std::vector<std::string_view>(uut.GetComponents().begin(), uut.GetComponents().end());
+			Assert::AreEqual(std::vector<std::string_view>({ "..", "..", "Folder" }), components, "Verify components match.");
+		}
+
+		// [[Fact]]
+		void Literal_ToPath()
+		{
+			auto uut = Path("C:/Folder/"_path);
+			Assert::AreEqual(Path("C:/Folder/"), uut, "Verify path matches.");
+			Assert::AreEqual("C:", uut.GetRoot(), "Verify root matches.");
+			Assert::IsFalse(uut.HasFileName(), "Verify has no file name.");
+
+			auto combined = uut + Path("./file.txt"_path);
+			Assert::AreEqual(Path("C:/Folder/file.txt"), combined, "Verify combined path matches.");
+		}
+
+		// [[Fact]]
+		void OperatorLessThan()
+		{
+			Assert::IsTrue(PathView("C:/A/") < PathView("C:/B/"), "Verify less than.");
+			Assert::IsFalse(PathView("C:/B/") < PathView("C:/A/"), "Verify not less than.");
+			Assert::IsTrue(PathView("C:/A/") != PathView("C:/B/"), "Verify not equal.");
+		}
+
+		// [[Fact]]
+		void TryCreate()
+		{
+			auto value = std::string("../Folder/file.txt");
+			auto uut = PathView();
+			Assert::IsTrue(PathView::TryCreate(value, uut), "Verify create succeeds.");
+			Assert::IsTrue(uut.ToStringView().data() == value.data(), "Verify the view references the original value.");
+			Assert::AreEqual("file.txt", uut.GetFileName(), "Verify file name matches.");
+
+			Assert::IsFalse(PathView::TryCreate("file.txt", uut), "Verify missing separator fails.");
+			Assert::IsFalse(PathView::TryCreate("Folder/file.txt", uut), "Verify unknown root fails.");
+			Assert::IsTrue(uut.ToStringView().data() == value.data(), "Verify result is unchanged.");
+		}
+	};
+}
@@ -0,0 +1,86 @@
+// <copyright file="relative-path-resolver-tests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::UnitTests
+{
+	class RelativePathResolverTests
+	{
+	public:
+		// [[Fact]]
+		void Initialize_FileBaseThrows()
+		{
+			auto exception = Assert::Throws<std::runtime_error>([&]()
+			{
+				auto uut = RelativePathResolver(Path("C:/Folder/File.txt"));
+			});
+			Assert::AreEqual(
+				"Cannot combine a path that is a file as the base.",
+				exception.what(),
+				"Verify exception value matches.");
+		}
+
+		// [[Fact]]
+		void Resolve_SharedDirectory()
+		{
+			auto uut = RelativePathResolver(Path("C:/Folder1/"));
+
+			auto result = uut.Resolve(Path("C:/Folder1/Folder2/File.txt"));
+
+			Assert::AreEqual("./Folder2/File.txt", result.ToString(), "Verify result matches.");
+			Assert::AreEqual("File.txt", result.GetFileName(), "Verify file name matches.");
+		}
+
+		// [[Fact]]
+		void Resolve_UpDirectories()
+		{
+			auto uut = RelativePathResolver(Path("C:/Folder1/Folder2/"));
+
+			Assert::AreEqual(
+				"../../Other/File.txt",
+				uut.Resolve(Path("C:/Other/File.txt")).ToString(),
+				"Verify result matches.");
+			Assert::AreEqual(
+				"../Folder22/",
+				uut.Resolve(Path("C:/Folder1/Folder22/")).ToString(),
+				"Verify partial directory name is not shared.");
+		}
+
+		// [[Fact]]
+		void Resolve_DifferentRoot()
+		{
+			auto uut = RelativePathResolver(Path("C:/Folder1/"));
+
+			Assert::AreEqual("D:/Folder1/File.txt", uut.Resolve(Path("D:/Folder1/File.txt")).ToString(), "Verify result matches.");
+			Assert::AreEqual("./Folder1/File.txt", uut.Resolve(Path("./Folder1/File.txt")).ToString(), "Verify relative result matches.");
+		}
+
+		// [[Fact]]
+		void ResolveAll_MatchesGetRelativeTo()
+		{
+			auto base = Path("C:/Root/Folder1/");
+			auto uut = RelativePathResolver(base);
+			auto paths = std::vector<Path>({
+				Path("C:/Root/Folder1/File.txt"),
+				Path("C:/Root/Folder2/"),
+				Path("C:/File.txt"),
+				Path("D:/Root/Folder1/File.txt"),
+				Path("C:/Root/Folder1/Folder3/Folder4/File.txt"),
+			});
+
+			auto buffer = std::string();
+			auto result = std::vector<PathView>();
+			uut.ResolveAll(paths, buffer, result);
+
+			Assert::AreEqual(paths.size(), result.size(), "Verify result count matches.");
+			for (auto i = 0u; i < paths.size(); i++)
+			{
+				auto expected = paths[i].GetRelativeTo(base);
+				Assert::AreEqual(expected.ToStringView(), result[i].ToStringView(), "Verify result matches.");
+				Assert::AreEqual(expected.HasFileName(), result[i].HasFileName(), "Verify has file name matches.");
+			}
+		}
+	};
+}
@@ -78,6 +78,22 @@ namespace Soup::UnitTests
 				"Verify are not equal.");
 		}
 
+		// [[Theory]]
+		// [[InlineData("1.2.3", "1.2.4", true)]]
+		// [[InlineData("1.5.0", "2.0.0", true)]]
+		// [[InlineData("2.0.0", "1.5.0", false)]]
+		// [[InlineData("1.2.9", "1.3.0", true)]]
+		// [[InlineData("1.3.0", "1.2.9", false)]]
+		// [[InlineData("1", "1.0.0", false)]]
+		// [[InlineData("1", "1.0.1", true)]]
+		void OperatorLessThanValues(std::string left, std::string right, bool expected)
+		{
+			auto leftVersion = SemanticVersion::Parse(left);
+			auto rightVersion = SemanticVersion::Parse(right);
+			Assert::AreEqual(expected, leftVersion < rightVersion, "Verify less than matches.");
+			Assert::AreEqual(expected, rightVersion > leftVersion, "Verify greater than matches.");
+		}
+
 		// [[Theory]]
 		// [[InlineData("1.2.3", 1, 2, 3)]]
 		// [[InlineData("3.2.1", 3, 2, 1)]]
@@ -128,5 +144,62 @@ namespace Soup::UnitTests
 				value,
 				"Verify matches expected value.");
 		}
+
+		// [[Theory]]
+		// [[InlineData(1, 2, 3, "1.2.3")]]
+		// [[InlineData(0, 0, 0, "0.0.0")]]
+		// [[InlineData(100, 200, 300, "100.200.300")]]
+		void FormatToValues(int major, int minor, int patch, std::string expected)
+		{
+			auto uut = SemanticVersion(major, minor, patch);
+			std::array<char, SemanticVersion::MaxFormatSize> buffer;
+			auto end = uut.FormatTo(buffer.data());
+			Assert::AreEqual(
+				expected,
+				std::string(buffer.data(), end),
+				"Verify matches expected value.");
+		}
+
+		// [[Fact]]
+		void FormatTo_MissingValues()
+		{
+			std::array<char, SemanticVersion::MaxFormatSize> buffer;
+			auto end = SemanticVersion(1).FormatTo(buffer.data());
+			Assert::AreEqual<std::string>("1", std::string(buffer.data(), end), "Verify major only matches.");
+
+			end = SemanticVersion(1, 2).FormatTo(buffer.data());
+			Assert::AreEqual<std::string>("1.2", std::string(buffer.data(), end), "Verify major and minor matches.");
+		}
+
+		// [[Fact]]
+		void FormatTo_LargestValue()
+		{
+			auto minimum = std::numeric_limits<int>::min();
+			std::array<char, SemanticVersion::MaxFormatSize> buffer;
+			auto end = SemanticVersion(minimum, minimum, minimum).FormatTo(buffer.data());
+			Assert::AreEqual(
+				SemanticVersion::MaxFormatSize,
+				static_cast<size_t>(end - buffer.data()),
+				"Verify fills the buffer.");
+			Assert::AreEqual<std::string>(
+				"-2147483648.-2147483648.-2147483648",
+				std::string(buffer.data(), end),
+				"Verify matches expected value.");
+		}
+
+		// [[Fact]]
+		void FormatTo_OutputIterator()
+		{
+			auto value = std::string("Version = ");
+			SemanticVersion(1, 2, 3).FormatTo(std::back_inserter(value));
+			Assert::AreEqual<std::string>("Version = 1.2.3", value, "Verify appended value matches.");
+		}
+
+		// [[Fact]]
+		void Format()
+		{
+			auto value = std::format("Using {} and {}", SemanticVersion(1, 2, 3), SemanticVersion(4, 5));
+			Assert::AreEqual<std::string>("Using 1.2.3 and 4.5", value, "Verify formatted value matches.");
+		}
 	};
 }
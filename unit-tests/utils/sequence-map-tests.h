@@ -0,0 +1,219 @@
+// <copyright file="sequence-map-tests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::UnitTests
+{
+	class SequenceMapTests
+	{
+	private:
+		/// <summary>
+		/// A key without a standard hash that can only be found with a linear scan
+		/// </summary>
+		struct UnhashedKey
+		{
+			int Value;
+
+			bool operator ==(const UnhashedKey& rhs) const = default;
+		};
+
+	public:
+		// [[Fact]]
+		void Initialize()
+		{
+			auto uut = SequenceMap<std::string, int>();
+			Assert::IsTrue(uut.begin() == uut.end(), "Verify map is empty.");
+			Assert::IsFalse(uut.Contains("Missing"), "Verify missing key.");
+
+			int* value;
+			Assert::IsFalse(uut.TryGet("Missing", value), "Verify missing key.");
+			Assert::IsTrue(value == nullptr, "Verify missing value.");
+		}
+
+		// [[Fact]]
+		void Insert_Small()
+		{
+			auto uut = SequenceMap<std::string, int>({
+				{ "Second", 2 },
+				{ "First", 1 },
+			});
+			uut.Insert("Third", 3);
+
+			auto [wasInserted, value] = uut.TryInsert("First", 4);
+			Assert::IsFalse(wasInserted, "Verify duplicate is not inserted.");
+			Assert::IsTrue(value == nullptr, "Verify duplicate has no value.");
+
+			Assert::AreEqual(1, uut["First"], "Verify value matches.");
+			Assert::AreEqual(2, uut["Second"], "Verify value matches.");
+			Assert::AreEqual(3, uut["Third"], "Verify value matches.");
+
+			auto keys = std::vector<std::string>();
+			for (auto& entry : uut)
+				keys.push_back(entry.first);
+			Assert::AreEqual(std::vector<std::string>({ "Second", "First", "Third" }), keys, "Verify insertion order.");
+
+			auto exception = Assert::Throws<std::runtime_error>([&]() {
+				uut.Insert("Second", 5);
+			});
+			Assert::AreEqual("Key already exists", exception.what(), "Verify Exception message");
+
+			exception = Assert::Throws<std::runtime_error>([&]() {
+				auto missing = uut["Missing"];
+			});
+			Assert::AreEqual("Missing key", exception.what(), "Verify Exception message");
+		}
+
+		// [[Fact]]
+		void Insert_Large()
+		{
+			// Insert enough keys to build the index and grow it several times
+			auto uut = SequenceMap<int, int>();
+			for (auto i = 0; i < 1000; i++)
+			{
+				auto key = (i * 7919) % 1000 * 1024;
+				auto [wasInserted, value] = uut.TryInsert(key, i);
+				Assert::IsTrue(wasInserted, "Verify key is inserted.");
+				Assert::AreEqual(i, *value, "Verify inserted value matches.");
+			}
+
+			for (auto i = 0; i < 1000; i++)
+			{
+				auto key = (i * 7919) % 1000 * 1024;
+				Assert::AreEqual(i, uut[key], "Verify value matches.");
+				Assert::IsFalse(uut.TryInsert(key, 0).first, "Verify duplicate is not inserted.");
+				Assert::IsFalse(uut.Contains(key + 1), "Verify missing key.");
+			}
+
+			auto position = 0;
+			for (auto& entry : uut)
+			{
+				Assert::AreEqual((position * 7919) % 1000 * 1024, entry.first, "Verify insertion order.");
+				position++;
+			}
+		}
+
+		// [[Fact]]
+		void Insert_Unindexed()
+		{
+			// Stay below the index threshold so every lookup scans the fingerprints, including a partial block
+			auto uut = SequenceMap<std::string, int, 1000>();
+			for (auto i = 0; i < 100; i++)
+				uut.Insert("Key" + std::to_string(i), i);
+
+			for (auto i = 0; i < 100; i++)
+			{
+				Assert::AreEqual(i, uut["Key" + std::to_string(i)], "Verify value matches.");
+				Assert::IsFalse(uut.Contains("Missing" + std::to_string(i)), "Verify missing key.");
+			}
+
+			Assert::IsTrue(uut.Erase("Key50"), "Verify key is erased.");
+			Assert::IsFalse(uut.Contains("Key50"), "Verify erased key is missing.");
+			Assert::AreEqual(99, uut["Key99"], "Verify later value matches.");
+		}
+
+		// [[Fact]]
+		void Copy_Large()
+		{
+			auto uut = SequenceMap<std::string, int, 4>();
+			for (auto i = 0; i < 20; i++)
+				uut.Insert(std::to_string(i), i);
+
+			auto copy = uut;
+			copy.Insert("20", 20);
+			Assert::IsTrue(copy.Contains("20"), "Verify copy has new key.");
+			Assert::IsFalse(uut.Contains("20"), "Verify original is unchanged.");
+			Assert::AreEqual(7, copy["7"], "Verify copy value matches.");
+
+			auto moved = std::move(copy);
+			Assert::AreEqual(20, moved["20"], "Verify moved value matches.");
+			Assert::IsFalse(copy.Contains("20"), "Verify moved from map is empty.");
+		}
+
+		// [[Fact]]
+		void TryGet_StringView()
+		{
+			// Look up both with and without the index
+			auto uut = SequenceMap<std::string, int, 4>();
+			for (auto i = 0; i < 8; i++)
+			{
+				uut.Insert("Key" + std::to_string(i), i);
+
+				int* value;
+				Assert::IsTrue(uut.TryGet(std::string_view("Key0"), value), "Verify key found.");
+				Assert::AreEqual(0, *value, "Verify value matches.");
+				Assert::IsTrue(uut.Contains("Key" + std::to_string(i)), "Verify key found.");
+				Assert::IsFalse(uut.Contains(std::string_view("Key")), "Verify missing key.");
+			}
+
+			Assert::AreEqual(7, uut["Key7"], "Verify value matches.");
+		}
+
+		// [[Fact]]
+		void TryEmplace()
+		{
+			auto uut = SequenceMap<std::string, std::vector<int>>();
+			auto [wasInserted, value] = uut.TryEmplace(std::string_view("Values"), 3, 7);
+			Assert::IsTrue(wasInserted, "Verify key is inserted.");
+			Assert::AreEqual(std::vector<int>({ 7, 7, 7 }), *value, "Verify value is constructed in place.");
+
+			auto [wasDuplicateInserted, duplicateValue] = uut.TryEmplace("Values", 1, 1);
+			Assert::IsFalse(wasDuplicateInserted, "Verify duplicate is not inserted.");
+			Assert::IsTrue(duplicateValue == nullptr, "Verify duplicate has no value.");
+
+			auto& emplaced = uut.Emplace("Empty");
+			Assert::IsTrue(emplaced.empty(), "Verify value is default constructed.");
+
+			auto exception = Assert::Throws<std::runtime_error>([&]() {
+				uut.Emplace("Empty");
+			});
+			Assert::AreEqual("Key already exists", exception.what(), "Verify Exception message");
+		}
+
+		// [[Theory]]
+		// [[InlineData(10)]]
+		// [[InlineData(100)]]
+		void Erase(int count)
+		{
+			auto uut = SequenceMap<int, int>();
+			uut.Reserve(static_cast<size_t>(count));
+			for (auto i = 0; i < count; i++)
+				uut.Insert(i, i * 2);
+
+			// Remove every third key and verify the remaining keys keep their order
+			for (auto i = 0; i < count; i += 3)
+				Assert::IsTrue(uut.Erase(i), "Verify key is erased.");
+			Assert::IsFalse(uut.Erase(0), "Verify missing key is not erased.");
+
+			auto expected = 1;
+			for (auto& entry : uut)
+			{
+				Assert::AreEqual(expected, entry.first, "Verify remaining key order.");
+				Assert::AreEqual(expected * 2, entry.second, "Verify remaining value.");
+				expected += expected % 3 == 1 ? 1 : 2;
+			}
+
+			for (auto i = 0; i < count; i++)
+				Assert::AreEqual(i % 3 != 0, uut.Contains(i), "Verify key found after erase.");
+
+			// Insert the removed keys again at the end
+			uut.Insert(0, 100);
+			Assert::AreEqual(100, uut[0], "Verify value matches.");
+			Assert::AreEqual(0, std::prev(uut.end())->first, "Verify key is last.");
+		}
+
+		// [[Fact]]
+		void Insert_UnhashedKey()
+		{
+			auto uut = SequenceMap<UnhashedKey, int>();
+			for (auto i = 0; i < 100; i++)
+				uut.Insert({ i }, i);
+
+			const int* value;
+			Assert::IsTrue(uut.TryGet({ 42 }, value), "Verify key found.");
+			Assert::AreEqual(42, *value, "Verify value matches.");
+			Assert::IsFalse(uut.Contains({ 100 }), "Verify missing key.");
+		}
+	};
+}
@@ -0,0 +1,163 @@
+// <copyright file="version-index-tests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::UnitTests
+{
+	class VersionIndexTests
+	{
+	public:
+		// [[Fact]]
+		void Initialize()
+		{
+			auto uut = VersionIndex();
+			Assert::AreEqual<size_t>(0, uut.GetPackageCount(), "Verify package count matches.");
+			Assert::AreEqual<size_t>(0, uut.GetVersionCount(), "Verify version count matches.");
+			Assert::AreEqual<size_t>(0, uut.GetVersions("Missing").size(), "Verify no versions.");
+
+			SemanticVersion result;
+			Assert::IsFalse(uut.TryGetLatest("Missing", result), "Verify missing package has no latest.");
+		}
+
+		// [[Fact]]
+		void Add_Sorted()
+		{
+			auto uut = VersionIndex();
+			Assert::IsTrue(uut.Add("Opal", SemanticVersion(1, 2, 0)), "Verify add succeeds.");
+			Assert::IsTrue(uut.Add("Opal", SemanticVersion(0, 9, 5)), "Verify add succeeds.");
+			Assert::IsTrue(uut.Add("Opal", SemanticVersion(1, 10)), "Verify add succeeds.");
+			Assert::IsFalse(uut.Add("Opal", SemanticVersion(1, 2)), "Verify equal version is not added.");
+			Assert::IsTrue(uut.Add("Soup", SemanticVersion(1, 2, 0)), "Verify add succeeds.");
+
+			Assert::AreEqual<size_t>(2, uut.GetPackageCount(), "Verify package count matches.");
+			Assert::AreEqual<size_t>(4, uut.GetVersionCount(), "Verify version count matches.");
+
+			auto versions = uut.GetVersions("Opal");
+			Assert::AreEqual<size_t>(3, versions.size(), "Verify version count matches.");
+			Assert::AreEqual<std::string>("0.9.5", versions[0].ToString(), "Verify version matches.");
+			Assert::AreEqual<std::string>("1.2.0", versions[1].ToString(), "Verify version matches.");
+			Assert::AreEqual<std::string>("1.10", versions[2].ToString(), "Verify version matches.");
+		}
+
+		// [[Fact]]
+		void Load_Catalog()
+		{
+			auto uut = VersionIndex();
+			uut.Add("mwasplund|Opal", SemanticVersion(0, 1, 0));
+			uut.Load(
+				"mwasplund|Opal@1.2.3\r\n"
+				"mwasplund|Opal@0.9.5\r\n"
+				"\r\n"
+				"mwasplund|Soup@0.1.0\n"
+				"mwasplund|Soup@0.2\n"
+				"mwasplund|Opal@1.2.3\n"
+				"mwasplund|Opal@0.1.0");
+
+			Assert::AreEqual<size_t>(2, uut.GetPackageCount(), "Verify package count matches.");
+			Assert::AreEqual<size_t>(5, uut.GetVersionCount(), "Verify version count matches.");
+
+			auto versions = uut.GetVersions("mwasplund|Opal");
+			Assert::AreEqual<size_t>(3, versions.size(), "Verify version count matches.");
+			Assert::AreEqual<std::string>("0.1.0", versions[0].ToString(), "Verify version matches.");
+			Assert::AreEqual<std::string>("0.9.5", versions[1].ToString(), "Verify version matches.");
+			Assert::AreEqual<std::string>("1.2.3", versions[2].ToString(), "Verify version matches.");
+
+			versions = uut.GetVersions("mwasplund|Soup");
+			Assert::AreEqual<size_t>(2, versions.size(), "Verify version count matches.");
+			Assert::AreEqual<std::string>("0.1.0", versions[0].ToString(), "Verify version matches.");
+			Assert::AreEqual<std::string>("0.2", versions[1].ToString(), "Verify version matches.");
+		}
+
+		// [[Fact]]
+		void Load_SemanticVersionFallback()
+		{
+			auto uut = VersionIndex();
+			uut.Load("Opal@1.2.3-beta\nOpal@01234567.1\n");
+
+			auto versions = uut.GetVersions("Opal");
+			Assert::AreEqual<size_t>(2, versions.size(), "Verify version count matches.");
+			Assert::AreEqual<std::string>("1.2.3", versions[0].ToString(), "Verify version matches.");
+			Assert::AreEqual<std::string>("1234567.1", versions[1].ToString(), "Verify version matches.");
+
+			auto exception = Assert::Throws<std::runtime_error>([&]() {
+				uut.Load("Opal@4194304.0.0\n");
+			});
+			Assert::AreEqual("Invalid package version entry: Opal@4194304.0.0", exception.what(), "Verify Exception message");
+			Assert::AreEqual<size_t>(2, uut.GetVersionCount(), "Verify nothing was loaded.");
+		}
+
+		// [[Fact]]
+		void Load_InvalidEntry()
+		{
+			auto uut = VersionIndex();
+			auto exception = Assert::Throws<std::runtime_error>([&]() {
+				uut.Load("Opal@1.2.3\nSoup\n");
+			});
+			Assert::AreEqual("Invalid package version entry: Soup", exception.what(), "Verify Exception message");
+			Assert::AreEqual<size_t>(0, uut.GetPackageCount(), "Verify nothing was loaded.");
+			Assert::AreEqual<size_t>(0, uut.GetVersionCount(), "Verify nothing was loaded.");
+		}
+
+		// [[Fact]]
+		void TryGetBestMatch()
+		{
+			auto uut = VersionIndex();
+			uut.Load("Opal@1.1.0\nOpal@1.2.0\nOpal@1.2.7\nOpal@1.3.1\nOpal@2.0.0\n");
+
+			SemanticVersion result;
+			Assert::IsTrue(uut.TryGetBestMatch("Opal", SemanticVersion(1), result), "Verify major match found.");
+			Assert::AreEqual(SemanticVersion(1, 3, 1), result, "Verify latest major match.");
+
+			Assert::IsTrue(uut.TryGetBestMatch("Opal", SemanticVersion(1, 2), result), "Verify minor match found.");
+			Assert::AreEqual(SemanticVersion(1, 2, 7), result, "Verify latest minor match.");
+
+			Assert::IsTrue(uut.TryGetBestMatch("Opal", SemanticVersion(1, 2, 0), result), "Verify exact match found.");
+			Assert::AreEqual(SemanticVersion(1, 2, 0), result, "Verify exact match.");
+
+			Assert::IsFalse(uut.TryGetBestMatch("Opal", SemanticVersion(1, 2, 1), result), "Verify missing patch.");
+			Assert::IsFalse(uut.TryGetBestMatch("Opal", SemanticVersion(1, 4), result), "Verify missing minor.");
+			Assert::IsFalse(uut.TryGetBestMatch("Opal", SemanticVersion(3), result), "Verify missing major.");
+			Assert::IsFalse(uut.TryGetBestMatch("Soup", SemanticVersion(1), result), "Verify missing package.");
+		}
+
+		// [[Fact]]
+		void TryGetLatestCompatible()
+		{
+			auto uut = VersionIndex();
+			uut.Load("Opal@1.1.0\nOpal@1.2.0\nOpal@1.2.7\nOpal@2.0.0\n");
+
+			SemanticVersion result;
+			Assert::IsTrue(uut.TryGetLatestCompatible("Opal", SemanticVersion(1, 2), result), "Verify compatible found.");
+			Assert::AreEqual(SemanticVersion(1, 2, 7), result, "Verify latest compatible.");
+
+			Assert::IsTrue(uut.TryGetLatestCompatible("Opal", SemanticVersion(2), result), "Verify compatible found.");
+			Assert::AreEqual(SemanticVersion(2, 0, 0), result, "Verify latest compatible.");
+
+			Assert::IsFalse(uut.TryGetLatestCompatible("Opal", SemanticVersion(1, 3), result), "Verify newer minimum.");
+			Assert::IsFalse(uut.TryGetLatestCompatible("Opal", SemanticVersion(0, 1), result), "Verify older major.");
+
+			Assert::IsTrue(uut.TryGetLatest("Opal", result), "Verify latest found.");
+			Assert::AreEqual(SemanticVersion(2, 0, 0), result, "Verify latest.");
+		}
+
+		// [[Fact]]
+		void GetRange()
+		{
+			auto uut = VersionIndex();
+			uut.Load("Opal@1.1.0\nOpal@1.2.0\nOpal@1.2.7\nOpal@2.0.0\n");
+
+			auto range = uut.GetRange("Opal", SemanticVersion(1, 2), SemanticVersion(2));
+			Assert::AreEqual<size_t>(2, range.size(), "Verify range size matches.");
+			Assert::AreEqual<std::string>("1.2.0", range[0].ToString(), "Verify version matches.");
+			Assert::AreEqual<std::string>("1.2.7", range[1].ToString(), "Verify version matches.");
+
+			range = uut.GetRange("Opal", SemanticVersion(-1), SemanticVersion(100000000));
+			Assert::AreEqual<size_t>(4, range.size(), "Verify unpacked bounds include all.");
+
+			range = uut.GetRange("Opal", SemanticVersion(2), SemanticVersion(1));
+			Assert::AreEqual<size_t>(0, range.size(), "Verify reversed range is empty.");
+		}
+	};
+}